@@ -0,0 +1,120 @@
+// Benchmark pentru cautarea celui mai devreme interval intr-o retea de 50 de filiale (SalonNetwork::FindEarliestSlots)
+// Compilare: g++ -std=c++17 -O2 -Iinclude bench/network_bench.cpp $(ls src/*.cpp | grep -v main.cpp) -o network_bench -pthread
+
+#include "salon_network.h"
+#include "service.h"
+#include "employee.h"
+#include "client.h"
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Beauty_Salon;
+
+namespace {
+    constexpr int BRANCH_COUNT = 50;
+    constexpr int BOOKED_DAYS = 5;          // Zilele aproape pline la inceputul ferestrei de cautare
+    constexpr int SEARCH_DAYS = 14;
+    constexpr size_t TOP_K = 20;
+    constexpr double RADIUS_KM = 10.0;
+    
+    // Filialele sunt imprastiate intr-un patrat de ~30 km in jurul centrului
+    const GeoPoint CENTER(44.4268, 26.1025);
+    
+    void BuildNetwork(SalonNetwork& network) {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<double> offset(-0.135, 0.135);
+        
+        for (int b = 0; b < BRANCH_COUNT; ++b) {
+            Branch& branch = network.AddBranch("Filiala " + std::to_string(b),
+                                               GeoPoint(CENTER.latitude + offset(rng), CENTER.longitude + offset(rng)));
+            branch.AddService(std::unique_ptr<Service>(new HairService("Tuns", 80.0, true, true)));
+            branch.AddService(std::unique_ptr<Service>(new NailService("Manichiura", 60.0, true, 10)));
+            for (int e = 0; e < 6; ++e) {
+                branch.AddEmployee(std::unique_ptr<Employee>(new Stylist("Stilist " + std::to_string(e), 40.0, e % 2 == 0, 5)));
+            }
+            for (int e = 0; e < 4; ++e) {
+                branch.AddEmployee(std::unique_ptr<Employee>(new Technician("Tehnician " + std::to_string(e), 35.0, true)));
+            }
+            branch.RebuildQualifications();
+        }
+        
+        // Umplem primele zile, astfel incat cautarea sa treaca prin multe intervale ocupate
+        Client client("Client", "0700000000");
+        const char* services[] = {"Tuns", "Manichiura"};
+        for (int b = 0; b < BRANCH_COUNT; ++b) {
+            for (int day = 0; day < BOOKED_DAYS; ++day) {
+                for (int minute = 9 * 60; minute < 20 * 60; minute += 15) {
+                    for (int i = 0; i < 6; ++i) {
+                        network.Book(b, client, services[(minute / 15 + i) % 2], TimeSlot::FromMinutes(day, minute, 60));
+                    }
+                }
+            }
+        }
+    }
+    
+    bool SameOffers(const std::vector<SlotOffer>& a, const std::vector<SlotOffer>& b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (a[i].branchId != b[i].branchId || a[i].slot.GetPacked() != b[i].slot.GetPacked()) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main() {
+    SalonNetwork network;
+    BuildNetwork(network);
+    
+    size_t appointments = 0;
+    for (const auto& branch : network.GetBranches()) {
+        appointments += branch->GetSchedule().GetAppointments().size();
+    }
+    std::cout << "Filiale: " << network.GetBranchCount()
+              << ", in raza de " << RADIUS_KM << " km: " << network.FindBranchesWithin(CENTER, RADIUS_KM).size()
+              << ", programari: " << appointments << "\n\n";
+    
+    std::vector<SlotOffer> reference;
+    const int queries = 20;
+    for (size_t threads : {1, 2, 4, 8, 16}) {
+        // Apelantul executa si el sarcini, deci pool-ul are threads - 1 fire
+        TaskPool pool(threads - 1);
+        network.SetTaskPool(&pool);
+        std::vector<SlotOffer> offers;
+    
+        auto start = std::chrono::steady_clock::now();
+        for (int q = 0; q < queries; ++q) {
+            offers = network.FindEarliestSlots("Tuns", CENTER, RADIUS_KM, 0, SEARCH_DAYS, TOP_K);
+        }
+        auto stop = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(stop - start).count() / queries;
+    
+        if (reference.empty()) {
+            reference = offers;
+        }
+        std::cout << "fire=" << threads << "  " << ms << " ms/cautare  oferte=" << offers.size()
+                  << (SameOffers(reference, offers) ? "" : "  REZULTAT DIFERIT") << "\n";
+        
+        TaskPoolStats stats = pool.GetStats();
+        std::cout << "        sarcini=" << stats.executed << " furate=" << stats.stolen 
+                  << " apelant=" << stats.runByCaller << " medie=" << stats.GetAverageTaskMicroseconds() << " us\n";
+        network.SetTaskPool(nullptr);
+    }
+    
+    if (!reference.empty()) {
+        const SlotOffer& best = reference.front();
+        std::cout << "\nPrimul interval: filiala " << best.branchId << " (" << best.distanceKm << " km), "
+                  << best.slot.ToString() << "\n";
+    
+        Client client("Client nou", "0711111111");
+        std::cout << "Programare in intervalul oferit: " << (network.Book(best, client) ? "reusita" : "esuata") << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,110 @@
+// Microbenchmark pentru nucleul de suprapunere: varianta scalara vs. AVX2
+// Compilare: g++ -std=c++17 -O2 -Iinclude bench/overlap_bench.cpp src/overlap_kernel.cpp -o overlap_bench
+
+#include "overlap_kernel.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Beauty_Salon;
+
+namespace {
+    // Rezultatele sunt acumulate aici ca sa nu fie eliminate de optimizator
+    volatile std::size_t g_sink = 0;
+    
+    // Bucla clasica: un apel OverlapsWith pentru fiecare pereche
+    std::size_t CountWithOverlapsWith(const TimeSlot& query, const std::vector<TimeSlot>& slots) {
+        std::size_t total = 0;
+        for (const auto& slot : slots) {
+            if (slot.OverlapsWith(query)) {
+                total++;
+            }
+        }
+        return total;
+    }
+    
+    template <typename Fn>
+    double MeasureNsPerInterval(std::size_t count, int repetitions, Fn fn) {
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repetitions; ++r) {
+            g_sink = g_sink + fn(r);
+        }
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        return ns / (static_cast<double>(count) * repetitions);
+    }
+}
+
+int main() {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> day(0, 29);
+    std::uniform_int_distribution<int> minute(9 * 60, 19 * 60);
+    std::uniform_int_distribution<int> duration(15, 120);
+
+    std::cout << "kernel activ: " << OverlapKernel::ActiveKernelName() << "\n";
+    std::cout << "n,timeslot_loop_ns,scalar_ns,avx2_ns,mask_ns\n";
+
+    for (std::size_t count : {64u, 1024u, 16384u, 262144u}) {
+        std::vector<TimeSlot> slots;
+        PackedIntervals intervals;
+        for (std::size_t i = 0; i < count; ++i) {
+            TimeSlot slot = TimeSlot::FromMinutes(day(rng), minute(rng), duration(rng));
+            slots.push_back(slot);
+            intervals.PushBack(slot);
+        }
+
+        std::vector<TimeSlot> queries;
+        for (int i = 0; i < 64; ++i) {
+            queries.push_back(TimeSlot::FromMinutes(day(rng), minute(rng), duration(rng)));
+        }
+
+        // Verificam ca toate variantele dau acelasi rezultat
+        std::vector<std::uint64_t> mask((count + 63) / 64);
+        for (const auto& query : queries) {
+            auto qs = static_cast<std::int32_t>(query.GetAbsoluteStart());
+            auto qe = static_cast<std::int32_t>(query.GetAbsoluteEnd());
+            std::size_t expected = CountWithOverlapsWith(query, slots);
+            if (OverlapKernel::CountScalar(qs, qe, intervals.starts.data(), intervals.ends.data(), count) != expected ||
+                OverlapKernel::CountAvx2(qs, qe, intervals.starts.data(), intervals.ends.data(), count) != expected ||
+                ComputeOverlapMask(qs, qe, intervals.starts.data(), intervals.ends.data(), count, mask.data()) != expected) {
+                std::cerr << "Rezultate diferite pentru n=" << count << "\n";
+                return 1;
+            }
+        }
+
+        int repetitions = static_cast<int>(std::max<std::size_t>(16, (1u << 24) / count));
+        auto query = [&](int r) { return queries[static_cast<std::size_t>(r) % queries.size()]; };
+
+        double loopNs = MeasureNsPerInterval(count, repetitions, [&](int r) {
+            return CountWithOverlapsWith(query(r), slots);
+        });
+        double scalarNs = MeasureNsPerInterval(count, repetitions, [&](int r) {
+            TimeSlot q = query(r);
+            return OverlapKernel::CountScalar(static_cast<std::int32_t>(q.GetAbsoluteStart()),
+                                              static_cast<std::int32_t>(q.GetAbsoluteEnd()),
+                                              intervals.starts.data(), intervals.ends.data(), count);
+        });
+        double avx2Ns = -1.0;
+        if (OverlapKernel::HasAvx2()) {
+            avx2Ns = MeasureNsPerInterval(count, repetitions, [&](int r) {
+                TimeSlot q = query(r);
+                return OverlapKernel::CountAvx2(static_cast<std::int32_t>(q.GetAbsoluteStart()),
+                                                static_cast<std::int32_t>(q.GetAbsoluteEnd()),
+                                                intervals.starts.data(), intervals.ends.data(), count);
+            });
+        }
+        double maskNs = MeasureNsPerInterval(count, repetitions, [&](int r) {
+            TimeSlot q = query(r);
+            return ComputeOverlapMask(static_cast<std::int32_t>(q.GetAbsoluteStart()),
+                                      static_cast<std::int32_t>(q.GetAbsoluteEnd()),
+                                      intervals.starts.data(), intervals.ends.data(), count, mask.data());
+        });
+
+        std::cout << count << "," << loopNs << "," << scalarNs << "," << avx2Ns << "," << maskNs << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,260 @@
+// Benchmark pentru caile fierbinti ale programului, preturilor si stocului, la scari de la 100 la 1M de programari.
+// Rezultatele sunt scrise in CSV (benchmark,appointments,iterations,ns_per_op), ca sa poata fi comparate intre rulari:
+// cu --baseline, fiecare masuratoare mai lenta decat referinta cu peste --tolerance este raportata si iesirea este 1.
+// Compilare: g++ -std=c++17 -O2 -Iinclude bench/salon_bench.cpp $(ls src/*.cpp | grep -v main.cpp) -o salon_bench -pthread
+// Utilizare: ./salon_bench [--max 1000000] [--out rezultate.csv] [--baseline referinta.csv] [--tolerance 0.25]
+
+#include "schedule.h"
+#include "service.h"
+#include "employee.h"
+#include "client.h"
+#include "product.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Beauty_Salon;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+    constexpr int EMPLOYEE_COUNT = 20;
+    constexpr int START_HOUR = 9;
+    constexpr int END_HOUR = 20;
+    constexpr int SLOTS_PER_EMPLOYEE_DAY = END_HOUR - START_HOUR;       // Programari de 60 de minute
+    constexpr int APPOINTMENTS_PER_DAY = EMPLOYEE_COUNT * SLOTS_PER_EMPLOYEE_DAY;
+    
+    // Fiecare masuratoare ruleaza cel putin atat (sau pana la numarul maxim de iteratii)
+    constexpr double TIME_BUDGET_MS = 200.0;
+    
+    // Rezultatele sunt acumulate aici ca sa nu fie eliminate de optimizator
+    volatile double g_sink = 0.0;
+    
+    struct BenchResult {
+        std::string name;
+        size_t appointments;
+        size_t iterations;
+        double nsPerOp;
+    };
+    
+    // Buffer de iesire care arunca tot ce primeste (pentru metodele care afiseaza)
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+        std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+    };
+    
+    // Ruleaza fn(i) pana la maxIterations sau pana se consuma bugetul de timp; primul apel nu este masurat
+    template <typename Fn>
+    BenchResult Measure(const char* name, size_t appointments, size_t maxIterations, Fn fn) {
+        fn(0);
+        size_t iterations = 0;
+        auto start = Clock::now();
+        double elapsed = 0.0;
+        while (iterations < maxIterations) {
+            fn(++iterations);
+            if ((iterations & 7) == 0 || iterations == maxIterations) {
+                elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+                if (elapsed >= TIME_BUDGET_MS) {
+                    break;
+                }
+            }
+        }
+        elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        return {name, appointments, iterations, elapsed / static_cast<double>(iterations)};
+    }
+    
+    // Programarea index din incarcarea initiala: fiecare angajat are cate o programare de 60 de minute pe ora
+    Appointment MakeAppointment(size_t index, const std::vector<Client>& clients,
+                                const std::vector<std::unique_ptr<Employee>>& employees, Service* service) {
+        int day = static_cast<int>(index / APPOINTMENTS_PER_DAY);
+        int inDay = static_cast<int>(index % APPOINTMENTS_PER_DAY);
+        int hour = START_HOUR + inDay / EMPLOYEE_COUNT;
+        return Appointment(clients[index % clients.size()], employees[inDay % EMPLOYEE_COUNT].get(), service,
+                           TimeSlot(day, hour, 0, 60));
+    }
+    
+    void RunScale(size_t scale, std::vector<BenchResult>& results) {
+        HairService haircut("Tuns", 80.0, true, true);
+        NailService manicure("Manichiura", 60.0, true, 10);
+        std::vector<std::unique_ptr<Employee>> employees;
+        for (int e = 0; e < EMPLOYEE_COUNT; ++e) {
+            employees.push_back(std::unique_ptr<Employee>(new Stylist("Stilist " + std::to_string(e), 40.0, true, 5)));
+        }
+        std::vector<Client> clients;
+        for (int c = 0; c < 64; ++c) {
+            clients.push_back(Client("Client " + std::to_string(c), "07" + std::to_string(10000000 + c)));
+        }
+        std::mt19937 rng(static_cast<unsigned>(scale));
+        
+        // Appointment::CalculateTotalPrice pe toate programarile incarcarii
+        std::vector<Appointment> appointments;
+        appointments.reserve(scale);
+        for (size_t i = 0; i < scale; ++i) {
+            appointments.push_back(MakeAppointment(i, clients, employees, &haircut));
+        }
+        int firstId = appointments.front().GetID();
+        results.push_back(Measure("Appointment::CalculateTotalPrice", scale, 1000000000, [&](size_t i) {
+            Appointment& appointment = appointments[i % scale];
+            appointment.CalculateTotalPrice();
+            g_sink = g_sink + appointment.GetTotalPrice();
+        }));
+        
+        Schedule schedule(START_HOUR, END_HOUR, EMPLOYEE_COUNT);
+        schedule.LoadAppointments(std::move(appointments));
+        int loadedDays = static_cast<int>((scale + APPOINTMENTS_PER_DAY - 1) / APPOINTMENTS_PER_DAY);
+        
+        // AddAppointment in zile libere, dupa incarcare (cate o programare de 30 de minute pe angajat si interval)
+        std::vector<int> addedIds;
+        results.push_back(Measure("Schedule::AddAppointment", scale, 2000, [&](size_t i) {
+            int day = loadedDays + static_cast<int>(i / (EMPLOYEE_COUNT * 22));
+            int inDay = static_cast<int>(i % (EMPLOYEE_COUNT * 22));
+            TimeSlot slot = TimeSlot::FromMinutes(day, START_HOUR * 60 + (inDay / EMPLOYEE_COUNT) * 30, 30);
+            if (schedule.AddAppointment(clients[i % clients.size()], employees[inDay % EMPLOYEE_COUNT].get(), &manicure, slot)) {
+                addedIds.push_back(schedule.GetAppointments().back().GetID());
+            }
+        }));
+        
+        results.push_back(Measure("Schedule::SuggestTimeSlots", scale, 1000, [&](size_t i) {
+            g_sink = g_sink + static_cast<double>(schedule.SuggestTimeSlots(clients[i % clients.size()], &manicure).size());
+        }));
+        
+        // GenerateDailyReport afiseaza raportul; iesirea este aruncata
+        NullBuffer nullBuffer;
+        std::streambuf* previous = std::cout.rdbuf(&nullBuffer);
+        results.push_back(Measure("Schedule::GenerateDailyReport", scale, 1000, [&](size_t i) {
+            schedule.GenerateDailyReport(START_HOUR + static_cast<int>(i % SLOTS_PER_EMPLOYEE_DAY));
+        }));
+        std::cout.rdbuf(previous);
+        
+        std::uniform_int_distribution<size_t> loadedIndex(0, scale - 1);
+        results.push_back(Measure("Schedule::FindAppointment", scale, 100000, [&](size_t) {
+            Appointment* appointment = schedule.FindAppointment(firstId + static_cast<int>(loadedIndex(rng)));
+            g_sink = g_sink + (appointment ? 1.0 : 0.0);
+        }));
+        
+        // FindAppointment marcheaza intervalele pentru reconstruire; o interogare le sincronizeaza inainte de stergeri
+        schedule.SuggestTimeSlots(clients[0], &manicure);
+        results.push_back(Measure("Schedule::RemoveAppointment", scale, addedIds.size() - 1, [&](size_t i) {
+            g_sink = g_sink + (schedule.RemoveAppointment(addedIds[addedIds.size() - 1 - i]) ? 1.0 : 0.0);
+        }));
+        
+        // ServicePackage::CalculateTotalPrice pe cate un pachet de 3 servicii la fiecare programare
+        {
+            std::vector<ServicePackage> packages(scale, ServicePackage("Pachet", 0.1));
+            for (auto& package : packages) {
+                package.AddService(&haircut);
+                package.AddService(&manicure);
+                package.AddService(&haircut);
+            }
+            results.push_back(Measure("ServicePackage::CalculateTotalPrice", scale, 1000000000, [&](size_t i) {
+                g_sink = g_sink + packages[i % scale].CalculateTotalPrice();
+            }));
+        }
+        
+        // Product::UpdateStock pe cate un produs la fiecare programare, in ordine aleatoare
+        {
+            std::vector<std::unique_ptr<Product>> products;
+            products.reserve(scale);
+            for (size_t i = 0; i < scale; ++i) {
+                products.emplace_back(new RetailProduct("SKU", 10.0));
+                products.back()->SetQuantity(100);
+            }
+            std::uniform_int_distribution<size_t> productIndex(0, scale - 1);
+            results.push_back(Measure("Product::UpdateStock", scale, 1000000000, [&](size_t i) {
+                g_sink = g_sink + (products[productIndex(rng)]->UpdateStock(i & 1 ? 1 : -1) ? 1.0 : 0.0);
+            }));
+        }
+    }
+    
+    void WriteCsv(std::ostream& out, const std::vector<BenchResult>& results) {
+        out << "benchmark,appointments,iterations,ns_per_op\n";
+        for (const auto& result : results) {
+            out << result.name << "," << result.appointments << "," << result.iterations << "," << result.nsPerOp << "\n";
+        }
+    }
+    
+    // Citeste un CSV scris de WriteCsv; cheia este (benchmark, appointments)
+    bool ReadBaseline(const char* path, std::map<std::pair<std::string, size_t>, double>& baseline) {
+        std::ifstream in(path);
+        if (!in) {
+            return false;
+        }
+        std::string line;
+        std::getline(in, line);
+        while (std::getline(in, line)) {
+            std::istringstream fields(line);
+            std::string name, appointments, iterations, ns;
+            if (std::getline(fields, name, ',') && std::getline(fields, appointments, ',') &&
+                std::getline(fields, iterations, ',') && std::getline(fields, ns)) {
+                baseline[{name, std::strtoull(appointments.c_str(), nullptr, 10)}] = std::strtod(ns.c_str(), nullptr);
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t maxScale = 1000000;
+    const char* outPath = nullptr;
+    const char* baselinePath = nullptr;
+    double tolerance = 0.25;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--max") == 0) {
+            maxScale = std::strtoull(argv[i + 1], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--out") == 0) {
+            outPath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--baseline") == 0) {
+            baselinePath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--tolerance") == 0) {
+            tolerance = std::strtod(argv[i + 1], nullptr);
+        }
+    }
+
+    std::vector<BenchResult> results;
+    for (size_t scale = 100; scale <= maxScale; scale *= 10) {
+        auto start = Clock::now();
+        RunScale(scale, results);
+        std::cerr << "programari=" << scale << " gata in "
+                  << std::chrono::duration<double>(Clock::now() - start).count() << " s\n";
+    }
+
+    if (outPath) {
+        std::ofstream out(outPath);
+        WriteCsv(out, results);
+    } else {
+        WriteCsv(std::cout, results);
+    }
+
+    if (!baselinePath) {
+        return 0;
+    }
+    std::map<std::pair<std::string, size_t>, double> baseline;
+    if (!ReadBaseline(baselinePath, baseline)) {
+        std::cerr << "Nu se poate citi referinta " << baselinePath << "\n";
+        return 1;
+    }
+    int regressions = 0;
+    for (const auto& result : results) {
+        auto it = baseline.find({result.name, result.appointments});
+        if (it == baseline.end() || it->second <= 0.0) {
+            continue;
+        }
+        double ratio = result.nsPerOp / it->second;
+        if (ratio > 1.0 + tolerance) {
+            std::cerr << "REGRESIE " << result.name << " la " << result.appointments << " programari: "
+                      << it->second << " -> " << result.nsPerOp << " ns/op (x" << ratio << ")\n";
+            regressions++;
+        }
+    }
+    std::cerr << regressions << " regresii fata de " << baselinePath << "\n";
+    return regressions ? 1 : 0;
+}
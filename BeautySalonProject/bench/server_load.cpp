@@ -0,0 +1,240 @@
+// Generator de incarcare pe loopback pentru serverul TCP (SalonServer): deschide multe conexiuni simultane,
+// fiecare trimitand cate o cerere (slots / book) si asteptand raspunsul inainte de urmatoarea, si masoara latentele.
+// Fara port, porneste un server in acelasi proces (pe un port liber); cu port, testeaza un "BeautySalon --serve <port>".
+// Compilare: g++ -std=c++17 -O2 -Iinclude bench/server_load.cpp $(ls src/*.cpp | grep -v main.cpp) -o server_load -pthread
+// Utilizare: ./server_load [conexiuni=1000] [cereri_per_conexiune=50] [port]
+
+#include "salon_server.h"
+#include "service_catalog.h"
+#include "service.h"
+#include "employee.h"
+#include "client.h"
+#include "inventory.h"
+#include "schedule.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Beauty_Salon;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+    constexpr int CLIENT_COUNT = 200;
+    constexpr int BOOKING_DAYS = 30;
+    
+    // Datele salonului pentru serverul din proces
+    struct SalonData {
+        ServiceCatalog catalog;
+        std::vector<std::unique_ptr<Employee>> employees;
+        std::vector<Client> clients;
+        Inventory inventory;
+        Schedule schedule;
+        
+        SalonData() : schedule(9, 20, 10) {
+            catalog.AddService(std::unique_ptr<Service>(new HairService("Tuns", 80.0, true, true)));
+            catalog.AddService(std::unique_ptr<Service>(new NailService("Manichiura", 60.0, true, 10)));
+            for (int e = 0; e < 6; ++e) {
+                employees.push_back(std::unique_ptr<Employee>(new Stylist("Stilist " + std::to_string(e), 40.0, e % 2 == 0, 5)));
+            }
+            for (int e = 0; e < 4; ++e) {
+                employees.push_back(std::unique_ptr<Employee>(new Technician("Tehnician " + std::to_string(e), 35.0, true)));
+            }
+            catalog.BuildQualifications(employees);
+            schedule.SetServiceCatalog(&catalog);
+            for (int c = 0; c < CLIENT_COUNT; ++c) {
+                clients.push_back(Client("Client " + std::to_string(c), "07" + std::to_string(10000000 + c)));
+            }
+        }
+    };
+    
+    // O conexiune a generatorului; are mereu cel mult o cerere in zbor
+    struct LoadConnection {
+        int fd;
+        int remaining;
+        Clock::time_point sentAt;
+    };
+    
+    std::string MakeRequest(std::mt19937& rng) {
+        const char* services[] = {"Tuns", "Manichiura"};
+        int day = static_cast<int>(rng() % BOOKING_DAYS);
+        std::string request;
+        if (rng() % 10 < 7) {
+            request = "slots " + std::string(services[rng() % 2]) + " " + std::to_string(day) + " 3\n";
+        } else {
+            int minute = 9 * 60 + static_cast<int>(rng() % 40) * 15;
+            char time[8];
+            std::snprintf(time, sizeof(time), "%02d:%02d", minute / 60, minute % 60);
+            request = "book " + std::to_string(1 + rng() % CLIENT_COUNT) + " " + services[rng() % 2] + " " +
+                      std::to_string(day) + " " + time + "\n";
+        }
+        return request;
+    }
+    
+    bool SendAll(int fd, const std::string& data) {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) {
+                return false;
+            }
+            sent += static_cast<size_t>(n);
+        }
+        return true;
+    }
+    
+    int Connect(std::uint16_t port) {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+        if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            if (fd >= 0) {
+                close(fd);
+            }
+            return -1;
+        }
+        int enable = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        return fd;
+    }
+    
+    double Percentile(const std::vector<double>& sorted, double p) {
+        if (sorted.empty()) {
+            return 0.0;
+        }
+        size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[index];
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int connectionCount = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int requestsPerConnection = argc > 2 ? std::atoi(argv[2]) : 50;
+    std::uint16_t port = argc > 3 ? static_cast<std::uint16_t>(std::atoi(argv[3])) : 0;
+
+    // Serverul din proces, daca nu s-a dat un port
+    std::unique_ptr<SalonData> data;
+    std::unique_ptr<CommandProcessor> processor;
+    std::unique_ptr<SalonServer> server;
+    std::thread serverThread;
+    if (port == 0) {
+        data.reset(new SalonData());
+        processor.reset(new CommandProcessor(data->catalog, data->employees, data->clients, data->inventory, data->schedule));
+        server.reset(new SalonServer(*processor));
+        if (!server->Listen("127.0.0.1", 0)) {
+            std::cerr << "Serverul nu poate asculta\n";
+            return 1;
+        }
+        port = server->GetPort();
+        serverThread = std::thread([&server]() { server->Run(); });
+    }
+
+    int epollFd = epoll_create1(0);
+    std::vector<LoadConnection> connections;
+    connections.reserve(static_cast<size_t>(connectionCount));
+    for (int i = 0; i < connectionCount; ++i) {
+        int fd = Connect(port);
+        if (fd < 0) {
+            std::cerr << "Conectare esuata dupa " << i << " conexiuni\n";
+            break;
+        }
+        connections.push_back({fd, requestsPerConnection, Clock::now()});
+    }
+    for (size_t i = 0; i < connections.size(); ++i) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = i;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, connections[i].fd, &event);
+    }
+
+    std::mt19937 rng(7);
+    std::vector<double> latencies;
+    latencies.reserve(connections.size() * static_cast<size_t>(std::max(requestsPerConnection, 0)));
+    size_t active = 0;
+    size_t errors = 0;
+
+    auto start = Clock::now();
+    for (auto& connection : connections) {
+        if (connection.remaining > 0) {
+            connection.sentAt = Clock::now();
+            SendAll(connection.fd, MakeRequest(rng));
+            connection.remaining--;
+            active++;
+        }
+    }
+
+    // Fiecare raspuns este o singura linie, iar pe conexiune e o singura cerere in zbor
+    std::vector<epoll_event> events(256);
+    char buffer[4096];
+    while (active > 0) {
+        int count = epoll_wait(epollFd, events.data(), static_cast<int>(events.size()), 5000);
+        if (count <= 0) {
+            std::cerr << "Fara raspuns de la server (" << active << " cereri in asteptare)\n";
+            break;
+        }
+        for (int e = 0; e < count; ++e) {
+            LoadConnection& connection = connections[events[e].data.u64];
+            ssize_t n = recv(connection.fd, buffer, sizeof(buffer), 0);
+            if (n <= 0) {
+                epoll_ctl(epollFd, EPOLL_CTL_DEL, connection.fd, nullptr);
+                active--;
+                continue;
+            }
+            if (std::memchr(buffer, '\n', static_cast<size_t>(n)) == nullptr) {
+                continue;
+            }
+            if (std::strncmp(buffer, "ERR", 3) == 0) {
+                errors++;
+            }
+            auto now = Clock::now();
+            latencies.push_back(std::chrono::duration<double, std::micro>(now - connection.sentAt).count());
+            if (connection.remaining > 0) {
+                connection.sentAt = now;
+                SendAll(connection.fd, MakeRequest(rng));
+                connection.remaining--;
+            } else {
+                active--;
+            }
+        }
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    for (auto& connection : connections) {
+        close(connection.fd);
+    }
+    close(epollFd);
+
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << "Conexiuni: " << connections.size() << ", cereri: " << latencies.size()
+              << " (respinse: " << errors << "), durata: " << seconds << " s, "
+              << static_cast<long long>(static_cast<double>(latencies.size()) / seconds) << " cereri/s\n";
+    std::cout << "Latenta (us): p50=" << Percentile(latencies, 0.50) << " p90=" << Percentile(latencies, 0.90)
+              << " p99=" << Percentile(latencies, 0.99) << " p99.9=" << Percentile(latencies, 0.999)
+              << " max=" << (latencies.empty() ? 0.0 : latencies.back()) << "\n";
+
+    if (server) {
+        server->Stop();
+        serverThread.join();
+        const SalonServerStats& stats = server->GetStats();
+        std::cout << "Server: acceptate=" << stats.accepted << " maxim simultan=" << stats.maxConnections
+                  << " comenzi=" << stats.commands << " treziri=" << stats.wakeups
+                  << " (" << (stats.wakeups ? static_cast<double>(stats.commands) / stats.wakeups : 0.0)
+                  << " comenzi/trezire), programari=" << data->schedule.GetAppointments().size() << "\n";
+    }
+    return 0;
+}
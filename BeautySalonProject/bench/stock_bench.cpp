@@ -0,0 +1,125 @@
+// Benchmark multi-fir pentru vanzarile de la case: compare-and-swap (Inventory::Sell) vs. mutex
+// Compilare: g++ -std=c++17 -O2 -Iinclude bench/stock_bench.cpp $(ls src/*.cpp | grep -v main.cpp) -o stock_bench -pthread
+
+#include "inventory.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace Beauty_Salon;
+
+namespace {
+    // Varianta de referinta: acelasi algoritm de verificare ca vechiul UpdateStock, protejat de un mutex global
+    bool LockedUpdate(std::mutex& mutex, int& stock, int quantity) {
+        std::lock_guard<std::mutex> lock(mutex);
+        int newQuantity = stock + quantity;
+        if (newQuantity < 0) {
+            return false;
+        }
+        stock = newQuantity;
+        return true;
+    }
+    
+    struct RunResult {
+        double nsPerOp;
+        long long sold;
+        bool consistent;
+    };
+    
+    // Fiecare fir vinde cate o bucata si, la fiecare al 8-lea pas, primeste o reaprovizionare de 1 bucata.
+    // La final stocul trebuie sa fie: initial + reaprovizionari - vanzari reusite (si niciodata negativ)
+    template <typename UpdateFn, typename GetFn>
+    RunResult Run(int threads, int skuCount, int opsPerThread, int initialStock, UpdateFn update, GetFn get) {
+        std::atomic<long long> sold(0);
+        std::atomic<long long> restocked(0);
+        std::atomic<bool> start(false);
+        std::vector<std::thread> workers;
+        
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t]() {
+                long long localSold = 0;
+                long long localRestocked = 0;
+                while (!start.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                for (int i = 0; i < opsPerThread; ++i) {
+                    int sku = (t + i) % skuCount;
+                    if (i % 8 == 7) {
+                        update(sku, 1);
+                        localRestocked++;
+                    } else if (update(sku, -1)) {
+                        localSold++;
+                    }
+                }
+                sold += localSold;
+                restocked += localRestocked;
+            });
+        }
+        
+        auto begin = std::chrono::steady_clock::now();
+        start.store(true, std::memory_order_release);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        auto end = std::chrono::steady_clock::now();
+        
+        long long remaining = 0;
+        bool nonNegative = true;
+        for (int sku = 0; sku < skuCount; ++sku) {
+            int quantity = get(sku);
+            nonNegative = nonNegative && quantity >= 0;
+            remaining += quantity;
+        }
+        
+        RunResult result;
+        result.nsPerOp = std::chrono::duration<double, std::nano>(end - begin).count() / 
+                         (static_cast<double>(threads) * opsPerThread);
+        result.sold = sold.load();
+        result.consistent = nonNegative && 
+                            remaining == static_cast<long long>(initialStock) * skuCount + restocked.load() - sold.load();
+        return result;
+    }
+}
+
+int main() {
+    const int opsPerThread = 1000000;
+    const int initialStock = 100000;
+    unsigned hardware = std::thread::hardware_concurrency();
+    
+    std::cout << "hardware_threads: " << hardware << "\n";
+    std::cout << "threads,skus,cas_ns_per_op,mutex_ns_per_op,cas_sold,mutex_sold,consistent\n";
+    
+    for (int threads : {1, 2, 4, 8, 16}) {
+        // 1 SKU = produs "fierbinte" (toate casele vand acelasi produs); 1024 SKU = contentie redusa
+        for (int skuCount : {1, 16, 1024}) {
+            Inventory inventory(0);
+            std::vector<Product*> products;
+            for (int i = 0; i < skuCount; ++i) {
+                std::unique_ptr<Product> product(new RetailProduct("SKU", 10.0));
+                product->SetQuantity(initialStock);
+                products.push_back(inventory.AddProduct(std::move(product)));
+            }
+            RunResult cas = Run(threads, skuCount, opsPerThread, initialStock,
+                [&](int sku, int quantity) {
+                    int id = products[sku]->GetID();
+                    return quantity > 0 ? inventory.Restock(id, quantity) : inventory.Sell(id, -quantity);
+                },
+                [&](int sku) { return products[sku]->GetQuantity(); });
+            
+            std::vector<int> locked(skuCount, initialStock);
+            std::mutex globalMutex;
+            RunResult mutex = Run(threads, skuCount, opsPerThread, initialStock,
+                [&](int sku, int quantity) { return LockedUpdate(globalMutex, locked[sku], quantity); },
+                [&](int sku) { return locked[sku]; });
+            
+            std::cout << threads << "," << skuCount << "," << cas.nsPerOp << "," << mutex.nsPerOp << ","
+                      << cas.sold << "," << mutex.sold << ","
+                      << ((cas.consistent && mutex.consistent) ? "yes" : "NO") << "\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,109 @@
+// Benchmark pentru generatorul de trafic (WorkloadGenerator): evenimente generate pe secunda, scrierea lor ca fisier
+// de comenzi si aplicarea directa pe Schedule (unde programul, nu generatorul, trebuie sa fie partea lenta)
+// Compilare: g++ -std=c++17 -O2 -Iinclude bench/workload_bench.cpp $(ls src/*.cpp | grep -v main.cpp) -o workload_bench -pthread
+// Utilizare: ./workload_bench [samanta=1]
+
+#include "workload.h"
+#include "report.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <ostream>
+#include <streambuf>
+
+using namespace Beauty_Salon;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+    // Buffer de iesire care doar numara bytes primiti
+    class CountingBuffer : public std::streambuf {
+    public:
+        std::size_t bytes = 0;
+        
+    protected:
+        int overflow(int c) override {
+            bytes++;
+            return c;
+        }
+        std::streamsize xsputn(const char*, std::streamsize count) override {
+            bytes += static_cast<std::size_t>(count);
+            return count;
+        }
+    };
+    
+    double Seconds(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+    
+    void PrintStats(const WorkloadStats& stats) {
+        std::cout << "        programari=" << stats.bookings << " anulari=" << stats.cancellations
+                  << " finalizari=" << stats.completions << " neprezentari=" << stats.noShows
+                  << " respinse=" << stats.rejectedBookings << "\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    WorkloadConfig config;
+    config.seed = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1;
+
+    // Un an de trafic pentru o retea mare (20000 de programari pe zi)
+    WorkloadConfig large = config;
+    large.dayCount = 365;
+    large.bookingsPerDay = 20000;
+    large.clientCount = 1000000;
+    {
+        WorkloadGenerator generator(large);
+        WorkloadEvent event;
+        std::uint64_t checksum = 0;
+        auto start = Clock::now();
+        while (generator.Next(event)) {
+            checksum += static_cast<std::uint64_t>(event.minute) + event.booking;
+        }
+        double seconds = Seconds(start);
+        std::cout << "Next:          " << generator.GetStats().events << " evenimente in " << seconds << " s = "
+                  << generator.GetStats().events / seconds / 1e6 << " M evenimente/s (control " << checksum << ")\n";
+        PrintStats(generator.GetStats());
+    }
+
+    {
+        WorkloadGenerator generator(large);
+        std::vector<std::unique_ptr<Employee>> employees;
+        CountingBuffer counter;
+        std::ostream out(&counter);
+        auto start = Clock::now();
+        generator.WriteCommands(out, employees);
+        double seconds = Seconds(start);
+        std::cout << "WriteCommands: " << generator.GetStats().events << " evenimente in " << seconds << " s = "
+                  << generator.GetStats().events / seconds / 1e6 << " M evenimente/s, "
+                  << counter.bytes / seconds / (1024.0 * 1024.0) << " MiB/s\n";
+    }
+
+    // Configuratia implicita (un salon, 90 de zile) aplicata direct pe program
+    {
+        WorkloadGenerator generator(config);
+        ServiceCatalog catalog;
+        std::vector<std::unique_ptr<Employee>> employees;
+        std::vector<Client> clients;
+        Inventory inventory;
+        generator.PopulateSalon(catalog, employees, clients, inventory);
+        Schedule schedule(config.openHour, config.closeHour, static_cast<int>(employees.size()));
+        schedule.SetServiceCatalog(&catalog);
+
+        auto start = Clock::now();
+        std::size_t events = generator.StreamInto(schedule, catalog, employees, clients);
+        double seconds = Seconds(start);
+        std::cout << "StreamInto:    " << events << " evenimente in " << seconds << " s = "
+                  << events / seconds / 1e3 << " k evenimente/s, programari in program: "
+                  << schedule.GetAppointments().size() << "\n";
+        PrintStats(generator.GetStats());
+
+        // Rezultatul trebuie sa fie acelasi la fiecare rulare cu aceeasi samanta
+        StatusBreakdown status;
+        for (const auto& appointment : schedule.GetAppointments()) {
+            status.Add(appointment.GetStatus());
+        }
+        std::cout << "        stari: programate=" << status.scheduled << " finalizate=" << status.completed
+                  << " anulate=" << status.cancelled << " neprezentari=" << status.noShow << "\n";
+    }
+    return 0;
+}
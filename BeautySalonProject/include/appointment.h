@@ -5,18 +5,12 @@
 #include "employee.h"
 #include "service.h"
 #include "utils.h"
+#include "interfaces.h"
 #include <string>
 #include <ctime>
 
 namespace Beauty_Salon {
-    // Enumerare pentru starea programarii
-    enum class AppointmentStatus {
-        SCHEDULED,      
-        IN_PROGRESS,    
-        COMPLETED,      
-        CANCELLED,      
-        NO_SHOW         
-    };
+    class DiscountProgram;
     
     // Clasa pentru gestionarea programarilor în salon
     class Appointment {
@@ -30,6 +24,7 @@ namespace Beauty_Salon {
         std::string m_notes;          
         double m_total_price;         
         bool m_is_confirmed;          
+        IConsumptionSink* m_consumption_sink;     // Primeste consumul de produse la finalizare (optional)
         
     public:
         // Membri statici
@@ -51,6 +46,7 @@ namespace Beauty_Salon {
         std::string GetNotes() const;
         double GetTotalPrice() const;
         bool IsConfirmed() const;
+        IConsumptionSink* GetConsumptionSink() const;
         
         // Setteri
         void SetEmployee(Employee* employee);
@@ -59,10 +55,14 @@ namespace Beauty_Salon {
         void SetStatus(AppointmentStatus status);
         void AddNotes(const std::string& notes);
         void SetConfirmed(bool confirmed);
+        void SetConsumptionSink(IConsumptionSink* sink);
         
         // Calculeaza prețul total al programarii, cu tot cu reduceri
         void CalculateTotalPrice();
         
+        // Calculeaza pretul total cu un program de reduceri compilat (in locul discount-ului clientului)
+        void CalculateTotalPrice(const DiscountProgram& discounts);
+        
         // Verifica daca programarea poate fi reprogramata, true daca programarea poate fi reprogramata
         bool CanReschedule() const;
         
@@ -75,9 +75,18 @@ namespace Beauty_Salon {
         // Marcheaza programarea ca finalizata, true dacă finalizarea a reusit
         bool Complete();
         
+        // Finalizeaza programarea si incaseaza pretul calculat cu programul de reduceri (inainte de a numara vizita)
+        bool Complete(const DiscountProgram& discounts);
+        
+        // Marcheaza clientul ca neprezentat, true daca programarea era inca activa
+        bool MarkNoShow();
+        
         // Afiseaza informatii despre programare
         void DisplayInfo() const;
         
+        // Scrie descrierea scurta a programarii in buffer (acelasi format ca operatorul <<)
+        void FormatTo(TextBuffer& out) const;
+        
         // Supraincarcarea operatorului pentru afisare
         friend std::ostream& operator<<(std::ostream& os, const Appointment& appointment);
     };
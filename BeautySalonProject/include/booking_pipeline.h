@@ -0,0 +1,124 @@
+#ifndef BOOKING_PIPELINE_H
+#define BOOKING_PIPELINE_H
+
+#include "schedule.h"
+#include "mpsc_queue.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Tipul unei cereri trimise prin pipeline
+    enum class BookingOperation {
+        BOOK,
+        CANCEL,
+        RESCHEDULE
+    };
+    
+    // Rezultatul unei cereri
+    enum class BookingStatus {
+        ACCEPTED,
+        REJECTED,           // Intervalul nu poate fi programat (ocupat, in afara programului sau a turei),
+                            // sau programarea de reprogramat este finalizata / clientul nu s-a prezentat
+        NOT_FOUND,          // Programarea de anulat / reprogramat nu exista (sau nu mai poate fi anulata)
+        STOPPED             // Pipeline-ul a fost oprit inainte de trimiterea cererii
+    };
+    
+    struct BookingResult {
+        BookingStatus status;
+        int appointmentId;                  // Programarea creata sau modificata (0 daca cererea nu a reusit)
+        const Employee* employee;           // Angajatul programarii (ales automat daca nu a fost cerut unul)
+        TimeSlot slot;
+        
+        BookingResult();
+        bool IsAccepted() const { return status == BookingStatus::ACCEPTED; }
+    };
+    
+    // O cerere asteptand in coada; clientul este copiat, ca apelantul sa nu trebuiasca sa-l pastreze
+    struct BookingRequest {
+        BookingOperation operation;
+        int appointmentId;
+        Client client;
+        Employee* employee;
+        Service* service;
+        TimeSlot slot;
+        std::promise<BookingResult> promise;
+        
+        BookingRequest(BookingOperation op, const Client& requestClient, Employee* requestEmployee,
+                       Service* requestService, const TimeSlot& requestSlot, int id);
+        BookingRequest(BookingRequest&&) = default;
+        BookingRequest& operator=(BookingRequest&&) = default;
+    };
+    
+    // Contoarele pipeline-ului
+    struct BookingPipelineStats {
+        std::uint64_t submitted;
+        std::uint64_t processed;
+        std::uint64_t accepted;
+        std::uint64_t batches;
+        std::uint64_t maxBatchSize;
+        
+        BookingPipelineStats();
+        double GetAverageBatchSize() const;
+    };
+    
+    // Intrarea asincrona in program: cererile de programare, anulare si reprogramare sunt puse intr-o coada
+    // marginita (mai multi producatori, un consumator), iar un singur fir le aplica pe Schedule,
+    // in ordinea in care au intrat in coada. Firul scoate din coada pana la maxBatch cereri deodata (loturile
+    // reduc doar sincronizarea cu producatorii); fiecare apelant primeste un std::future, completat imediat dupa
+    // aplicarea cererii lui. Cat timp pipeline-ul ruleaza, Schedule este modificat doar de firul lui
+    class BookingPipeline {
+    private:
+        Schedule& m_schedule;
+        BoundedMpscQueue<BookingRequest> m_queue;
+        size_t m_max_batch;
+        
+        std::thread m_worker;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::atomic<bool> m_worker_sleeping;
+        std::atomic<bool> m_stopping;               // Nu se mai accepta cereri noi
+        std::atomic<size_t> m_active_producers;     // Apelanti aflati in Submit
+        bool m_stop;                                // Firul termina dupa golirea cozii (protejat de m_mutex)
+        
+        std::atomic<std::uint64_t> m_submitted;
+        std::atomic<std::uint64_t> m_processed;
+        std::atomic<std::uint64_t> m_accepted;
+        std::atomic<std::uint64_t> m_batches;
+        std::atomic<std::uint64_t> m_max_batch_seen;
+        
+        void _Run();
+        
+        // Aplica o cerere pe program
+        BookingResult _Apply(BookingRequest& request);
+        
+        // Pune cererea in coada (asteapta daca e plina) si intoarce rezultatul viitor
+        std::future<BookingResult> _Submit(BookingRequest request);
+        
+    public:
+        // Porneste firul de programare. Capacitatea cozii este rotunjita la o putere a lui 2
+        explicit BookingPipeline(Schedule& schedule, size_t queueCapacity = 1024, size_t maxBatch = 64);
+        BookingPipeline(const BookingPipeline&) = delete;
+        BookingPipeline& operator=(const BookingPipeline&) = delete;
+        ~BookingPipeline();
+        
+        // Cereri; pot fi apelate din orice fir
+        std::future<BookingResult> Book(const Client& client, Service* service, const TimeSlot& slot);
+        std::future<BookingResult> Book(const Client& client, Employee* employee, Service* service, const TimeSlot& slot);
+        std::future<BookingResult> Cancel(int appointmentId);
+        std::future<BookingResult> Reschedule(int appointmentId, const TimeSlot& newSlot);
+        
+        // Opreste primirea cererilor, aplica cererile ramase in coada si opreste firul
+        void Stop();
+        bool IsRunning() const;
+        
+        BookingPipelineStats GetStats() const;
+    };
+}
+
+#endif // BOOKING_PIPELINE_H
@@ -2,6 +2,8 @@
 #define CLIENT_H
 
 #include "interfaces.h"
+#include "format.h"
+#include <atomic>
 #include <string>
 #include <vector>
 #include <ostream>
@@ -19,10 +21,14 @@ namespace Beauty_Salon {
         int m_visits;                 
         bool m_is_vip;                
         double m_loyalty_points;      
+        double m_discount_rate;       // Discount-ul curent (procent), recalculat cand se schimba vizitele sau statutul VIP
+        
+        // Recalculeaza discount-ul in functie de statutul VIP si numarul de vizite
+        void _UpdateDiscountRate();
         
     public:
         // Membri statici
-        static int m_total_clients;   
+        static std::atomic<int> m_total_clients;    // Atomic: copii ale clientilor sunt create si distruse pe mai multe fire
         static int GetTotalClients(); 
         
         // Constructori si destructor
@@ -30,16 +36,22 @@ namespace Beauty_Salon {
         Client(const std::string& name);
         Client(const std::string& name, const std::string& phone);
         Client(const std::string& name, const std::string& phone, const std::string& email);
+        // Copiile sunt numarate, ca destructorul sa nu scada contorul sub numarul real de obiecte
+        Client(const Client& other);
+        Client& operator=(const Client& other) = default;
         ~Client();
         
         // Getteri
-        std::string GetName() const;
+        const std::string& GetName() const;
         std::string GetPhone() const;
         std::string GetEmail() const;
         int GetVisits() const;
         bool IsVIP() const;
         double GetLoyaltyPoints() const;
         
+        // Discount-ul clientului (procent) - citire fara apel virtual
+        double GetDiscountRate() const { return m_discount_rate; }
+        
         // Setteri
         void SetPhone(const std::string& phone);
         void SetEmail(const std::string& email);
@@ -60,9 +72,15 @@ namespace Beauty_Salon {
         // Afiseaza informatii despre client
         void DisplayInfo() const;
         
+        // Scrie descrierea scurta a clientului in buffer (acelasi format ca operatorul <<)
+        void FormatTo(TextBuffer& out) const;
+        
         // Supraincarcarea operatorului pentru afisare
         friend std::ostream& operator<<(std::ostream& os, const Client& client);
     };
+    
+    // Scrie lista numerotata a clientilor in buffer, pentru afisarea cu un singur apel de write
+    void RenderClientList(TextBuffer& out, const std::vector<Client>& clients);
 }
 
 #endif // CLIENT_H
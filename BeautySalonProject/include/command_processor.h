@@ -0,0 +1,137 @@
+#ifndef COMMAND_PROCESSOR_H
+#define COMMAND_PROCESSOR_H
+
+#include "schedule.h"
+#include "service_catalog.h"
+#include "inventory.h"
+#include "employee.h"
+#include "client.h"
+#include "report.h"
+#include "format.h"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Contoarele procesorului de comenzi
+    struct CommandStats {
+        std::uint64_t lines;            // Linii citite (inclusiv comentarii si linii goale)
+        std::uint64_t commands;         // Comenzi executate
+        std::uint64_t errors;           // Comenzi respinse
+        
+        CommandStats();
+    };
+    
+    // Procesor de comenzi pe linii, pentru rularea neinteractiva (scripturi, reluarea unor incarcari, teste de incarcare).
+    // Fiecare comanda produce exact o linie de raspuns: "OK <comanda> cheie=valoare ..." sau "ERR <comanda> error=<motiv>"
+    // (in format JSON: un obiect pe linie). Rapoartele adauga dupa raspuns numarul de linii anuntat in campul lines.
+    //
+    // Comenzi (argumentele cu spatii se pun intre ghilimele; zilele sunt numere, orele HH:MM):
+    //   client <nume> [telefon] [email]                 adauga un client; raspunde cu id-ul lui
+    //   book <client> <serviciu> <zi> <ora> [angajat]   programeaza (angajatul este ales automat daca lipseste)
+    //   cancel <programare>
+    //   complete <programare>
+    //   noshow <programare>
+    //   reschedule <programare> <zi> <ora>
+    //   slots <serviciu> <zi> [numar]                   primele intervale libere incepand cu ziua data
+    //   restock <produs> <cantitate>
+    //   consume <produs> <cantitate>
+    //   report daily <ora> | schedule <ora> | employees | metrics [reset]
+    //   format text|json
+    //   stats
+    //   quit
+    // O programare se indica prin ID sau prin @n = programarea creata de a n-a comanda book din sesiune
+    // (util pentru fisiere generate, in care ID-urile nu se cunosc dinainte).
+    // "report metrics" exporta contoarele de performanta (programul trebuie compilat cu -DSALON_METRICS);
+    // cu "reset" contoarele sunt reluate de la zero dupa export.
+    // Liniile goale si cele care incep cu '#' sunt ignorate
+    class CommandProcessor {
+    private:
+        // Un argument al comenzii (indica in linia citita)
+        using Token = std::string_view;
+        static constexpr size_t MAX_TOKENS = 8;
+        
+        ServiceCatalog& m_catalog;
+        std::vector<std::unique_ptr<Employee>>& m_employees;
+        std::vector<Client>& m_clients;
+        Inventory& m_inventory;
+        Schedule& m_schedule;
+        
+        ReportFormat m_format;                  // TEXT sau JSON (formatul raspunsurilor si al rapoartelor)
+        ReportWriter m_report_writer;           // Refolosit intre rapoarte
+        CommandStats m_stats;
+        std::vector<int> m_booking_ids;         // ID-ul creat de fiecare comanda book (0 = respinsa), pentru @n
+        bool m_quit;
+        
+        // Bufferul in care se scrie raspunsul comenzii curente
+        TextBuffer* m_out;
+        
+        // Imparte linia in argumente; intoarce numarul lor sau MAX_TOKENS + 1 daca sunt prea multe
+        static size_t _Tokenize(std::string_view line, Token* tokens);
+        
+        static bool _ParseInt(Token token, long long& value);
+        static bool _ParseTime(Token token, int& minuteOfDay);
+        
+        // Zi in [0, TimeSlot::MAX_DAY - zilele cautate de slots]
+        static bool _ParseDay(Token token, int& day);
+        
+        // ID sau @n; un @n necunoscut sau un ID in afara [1, INT_MAX] da ID-ul 0 (programare inexistenta)
+        bool _ParseAppointment(Token token, int& id) const;
+        
+        // Scrierea raspunsurilor
+        void _BeginResponse(bool ok, Token command);
+        void _AppendJsonString(Token value);
+        void _Field(const char* key, long long value);
+        void _Field(const char* key, Token value);
+        void _FieldSlot(const TimeSlot& slot);
+        void _EndResponse();
+        void _Error(Token command, const char* reason);
+        
+        // Comenzile
+        void _AddClient(const Token* args, size_t count);
+        void _Book(const Token* args, size_t count);
+        void _Cancel(const Token* args, size_t count);
+        void _Complete(const Token* args, size_t count);
+        void _NoShow(const Token* args, size_t count);
+        void _Reschedule(const Token* args, size_t count);
+        void _Slots(const Token* args, size_t count);
+        void _Stock(Token command, const Token* args, size_t count);
+        void _Report(const Token* args, size_t count);
+        void _Format(const Token* args, size_t count);
+        void _Stats();
+        
+        Employee* _FindEmployee(long long id) const;
+        
+    public:
+        CommandProcessor(ServiceCatalog& catalog, std::vector<std::unique_ptr<Employee>>& employees,
+                         std::vector<Client>& clients, Inventory& inventory, Schedule& schedule);
+        CommandProcessor(const CommandProcessor&) = delete;
+        CommandProcessor& operator=(const CommandProcessor&) = delete;
+        
+        ReportFormat GetFormat() const;
+        void SetFormat(ReportFormat format);
+        const CommandStats& GetStats() const;
+        
+        // Comanda quit a fost primita
+        bool IsQuitRequested() const;
+        // Permite executarea comenzilor dupa quit (de exemplu pentru urmatoarea conexiune a serverului)
+        void ClearQuitRequest();
+        
+        // Schimba tabela referintelor @n cu cea data (serverul pastreaza cate o tabela pentru fiecare conexiune)
+        void SwapBookingReferences(std::vector<int>& bookingIds);
+        
+        // Executa o linie (fara '\n') si adauga raspunsul in out
+        void ExecuteLine(std::string_view line, TextBuffer& out);
+        
+        // Citeste comenzi din in pana la sfarsit sau quit si scrie raspunsurile in out.
+        // Intrarea este citita in blocuri mari, iar raspunsurile sunt scrise in blocuri de cel putin flushBytes
+        void Run(std::istream& in, std::ostream& out, size_t flushBytes = 64 * 1024);
+    };
+}
+
+#endif // COMMAND_PROCESSOR_H
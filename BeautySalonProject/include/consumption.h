@@ -0,0 +1,120 @@
+#ifndef CONSUMPTION_H
+#define CONSUMPTION_H
+
+#include "interfaces.h"
+#include "inventory.h"
+#include "service.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Beauty_Salon {
+    // O linie din lista de materiale a unui serviciu: produsul folosit si numarul de utilizari
+    struct MaterialLine {
+        int productId;          
+        int uses;               
+    };
+    
+    // Evenimentul de consum emis la finalizarea unei programari
+    struct UsageEvent {
+        int appointmentId;      
+        int productId;          
+        int uses;               
+    };
+    
+    // Semnal emis cand una sau mai multe unitati ale unui produs profesional au fost inlocuite
+    struct ReplacementSignal {
+        int productId;          
+        int unitsReplaced;      
+        int usageCount;         // Utilizarile ramase pe unitatea curenta
+    };
+    
+    // Semnal emis cand stocul unui produs consumat trebuie recomandat
+    struct ReorderSignal {
+        int productId;          
+        int available;          
+        int threshold;          
+        bool outOfStock;        // Nu a existat stoc pentru inlocuirea unei unitati uzate
+    };
+    
+    // Rezultatul aplicarii unui lot de consum
+    struct ConsumptionReport {
+        size_t eventsApplied;                       
+        size_t productsUpdated;                     
+        std::vector<ReplacementSignal> replacements;
+        std::vector<ReorderSignal> reorders;
+        
+        ConsumptionReport();
+    };
+    
+    // Lista de materiale (bill of materials) per serviciu, cu valori implicite per tip de serviciu
+    class BillOfMaterials {
+    private:
+        std::unordered_map<const Service*, std::vector<MaterialLine>> m_by_service;    
+        std::vector<MaterialLine> m_by_type[SERVICE_TYPE_COUNT];                       
+        
+    public:
+        BillOfMaterials();
+        
+        // Materialele folosite de un serviciu anume sau de toate serviciile de un anumit tip
+        void SetServiceMaterials(const Service* service, const std::vector<MaterialLine>& materials);
+        void SetTypeMaterials(ServiceType type, const std::vector<MaterialLine>& materials);
+        void AddServiceMaterial(const Service* service, int productId, int uses);
+        
+        // Materialele serviciului; daca nu are o lista proprie, se foloseste lista tipului sau
+        const std::vector<MaterialLine>& GetMaterials(const Service* service) const;
+    };
+    
+    // Colecteaza consumul programarilor finalizate si il aplica pe produse in loturi.
+    // OnAppointmentCompleted/Record pot fi apelate din mai multe fire: evenimentele sunt agregate
+    // per produs in shard-uri alese dupa firul apelant, iar produsele sunt atinse doar la Flush
+    class ConsumptionTracker : public IConsumptionSink {
+    private:
+        // Evenimentele neaplicate, agregate per produs (aliniat pentru a evita false sharing)
+        struct alignas(64) Shard {
+            std::mutex mutex;
+            std::unordered_map<int, int> pending;
+            size_t events = 0;
+        };
+        
+        Inventory& m_inventory;                                 
+        const BillOfMaterials& m_materials;                     
+        std::vector<std::unique_ptr<Shard>> m_shards;           
+        std::atomic<size_t> m_pending_events;                   
+        size_t m_batch_size;                                    
+        std::mutex m_flush_mutex;                               
+        std::unordered_map<int, int> m_batch;                   // Refolosit intre loturi
+        
+        // Shard-ul firului curent
+        Shard& _LocalShard();
+        
+        // Aplica utilizarile pe un produs si emite semnalele de inlocuire si recomandare
+        void _ApplyUsage(int productId, int uses, ConsumptionReport& report);
+        
+    public:
+        ConsumptionTracker(Inventory& inventory, const BillOfMaterials& materials, size_t shardCount = 16);
+        ConsumptionTracker(const ConsumptionTracker&) = delete;
+        ConsumptionTracker& operator=(const ConsumptionTracker&) = delete;
+        
+        // Implementarea IConsumptionSink: emite cate un eveniment pentru fiecare material al serviciului
+        virtual void OnAppointmentCompleted(const Appointment& appointment) override;
+        
+        // Inregistreaza un eveniment de consum
+        void Record(const UsageEvent& event);
+        
+        // Numarul de evenimente inregistrate si neaplicate inca
+        size_t GetPendingEvents() const;
+        
+        // Dimensiunea lotului dupa care IsBatchReady devine true
+        size_t GetBatchSize() const;
+        void SetBatchSize(size_t batchSize);
+        bool IsBatchReady() const;
+        
+        // Aplica evenimentele acumulate pe produse; apelata de un singur fir (cel care detine inventarul)
+        ConsumptionReport Flush();
+    };
+}
+
+#endif // CONSUMPTION_H
@@ -0,0 +1,135 @@
+#ifndef DISCOUNT_RULES_H
+#define DISCOUNT_RULES_H
+
+#include "utils.h"
+#include "product.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Beauty_Salon {
+    class Appointment;
+    class Client;
+    
+    // Nivelul clientului pentru regulile de discount
+    enum class ClientTier {
+        REGULAR,
+        VIP
+    };
+    
+    // Numarul maxim de grupuri de reduceri. Reducerile din acelasi grup se aduna,
+    // iar grupurile se aplica una dupa alta (multiplicativ).
+    constexpr int MAX_DISCOUNT_GROUPS = 4;
+    
+    // Grupurile folosite de regulile standard ale salonului
+    constexpr int DISCOUNT_GROUP_SALE = 0;      // Reducerea de sold a produselor
+    constexpr int DISCOUNT_GROUP_CLIENT = 1;    // VIP si fidelitate
+    constexpr int DISCOUNT_GROUP_PROMOTION = 2; // Promotii (ora, tip de serviciu)
+    constexpr int DISCOUNT_GROUP_BUNDLE = 3;    // Pachete de servicii si produse
+    
+    // Bitul de categorie pentru o categorie de produse (serviciile folosesc ServiceTypeBit, bitii 0-15)
+    constexpr std::uint32_t ProductCategoryBit(ProductCategory category) {
+        return std::uint32_t(1) << (16 + static_cast<int>(category));
+    }
+    
+    // Masca pentru toate serviciile si, respectiv, toate produsele
+    constexpr std::uint32_t ALL_SERVICES_MASK = 0x0000FFFFu;
+    constexpr std::uint32_t ALL_PRODUCTS_MASK = 0xFFFF0000u;
+    
+    // O linie de la casa (serviciu sau produs) pentru evaluarea in lot a reducerilor
+    struct LineItem {
+        double price;               // Pretul de lista, inainte de reduceri
+        std::uint32_t categoryBit;  // ServiceTypeBit sau ProductCategoryBit
+        int minuteOfDay;            // Momentul programarii / vanzarii
+        ClientTier tier;            
+        int clientVisits;           
+        int bundleId;               // 0 daca linia nu face parte dintr-un pachet
+        bool onSale;                
+        
+        LineItem();
+    };
+    
+    // O regula de promotie. Se construieste cu metodele statice si se rafineaza cu metodele With*/InGroup.
+    // Reducerea este min(maxPercent, percent + perVisitPercent * vizite).
+    struct DiscountRule {
+        std::string name;               
+        std::uint32_t categoryMask;     // Categoriile carora li se aplica regula
+        std::uint32_t tierMask;         // Bitul (1 << ClientTier) pentru nivelurile acceptate
+        int startMinute;                // Fereastra orara [startMinute, endMinute)
+        int endMinute;                  
+        int minVisits;                  
+        int bundleId;                   // -1: orice linie, 0: orice pachet, >0: doar pachetul dat
+        bool requiresSale;              
+        double percent;                 
+        double perVisitPercent;         
+        double maxPercent;              
+        int group;                      
+        
+        DiscountRule();
+        
+        // Reguli tipice
+        static DiscountRule Percent(const std::string& name, double percent);
+        static DiscountRule ForClientTier(const std::string& name, ClientTier tier, double percent);
+        static DiscountRule Loyalty(const std::string& name, double perVisitPercent, double maxPercent);
+        static DiscountRule TimeOfDay(const std::string& name, int startMinute, int endMinute, double percent);
+        static DiscountRule ForServiceType(const std::string& name, ServiceType type, double percent);
+        static DiscountRule ForBundle(const std::string& name, int bundleId, double percent);
+        static DiscountRule Sale(const std::string& name, double percent);
+        
+        // Rafinari (se pot inlantui)
+        DiscountRule& WithCategories(std::uint32_t mask);
+        DiscountRule& WithTier(ClientTier tier);
+        DiscountRule& WithTimeWindow(int start, int end);
+        DiscountRule& WithMinVisits(int visits);
+        DiscountRule& InGroup(int discountGroup);
+    };
+    
+    // Programul de reduceri compilat: regulile sunt stocate ca tablouri plate (structura de tablouri)
+    // si indexate dupa bitul de categorie, astfel incat o linie verifica doar regulile care o pot afecta
+    class DiscountProgram {
+    private:
+        // Campurile regulilor, cate un tablou pentru fiecare camp
+        std::vector<std::uint32_t> m_tier_mask;
+        std::vector<std::int32_t> m_start_minute;
+        std::vector<std::int32_t> m_end_minute;
+        std::vector<std::int32_t> m_min_visits;
+        std::vector<std::int32_t> m_bundle_id;
+        std::vector<std::uint8_t> m_requires_sale;
+        std::vector<std::uint8_t> m_group;
+        std::vector<double> m_percent;
+        std::vector<double> m_per_visit_percent;
+        std::vector<double> m_max_percent;
+        
+        // Pentru fiecare bit de categorie, regulile care il accepta: m_bucket_rules[m_bucket_start[b] .. m_bucket_start[b + 1])
+        std::vector<std::uint32_t> m_bucket_start;
+        std::vector<std::uint32_t> m_bucket_rules;
+        
+    public:
+        DiscountProgram();
+        
+        // Compileaza un set de reguli (regulile cu grup invalid sunt ignorate)
+        static DiscountProgram Compile(const std::vector<DiscountRule>& rules);
+        
+        size_t GetRuleCount() const;
+        
+        // Pretul unei singure linii dupa aplicarea tuturor regulilor
+        double Evaluate(const LineItem& item) const;
+        
+        // Evalueaza in lot: scrie pretul final al fiecarei linii in prices (daca nu e nullptr) si intoarce totalul
+        double EvaluateBatch(const LineItem* items, size_t count, double* prices) const;
+        double EvaluateBatch(const std::vector<LineItem>& items, std::vector<double>* prices) const;
+    };
+    
+    // Regulile de discount folosite pana acum in cod: VIP 10%, 0.5% pe vizita (maxim 5%) si sold 15% la produse
+    std::vector<DiscountRule> CreateStandardRules();
+    
+    // Construirea liniilor din obiectele salonului
+    LineItem MakeLineItem(const Appointment& appointment);
+    LineItem MakeLineItem(const Product& product, const Client* client, int minuteOfDay);
+    
+    // Liniile pentru toate programarile (cu serviciu) dintr-o lista
+    std::vector<LineItem> MakeLineItems(const std::vector<Appointment>& appointments);
+}
+
+#endif // DISCOUNT_RULES_H
@@ -13,7 +13,7 @@ namespace Beauty_Salon {
         std::string m_name;                       
         std::string m_role;                       
         double m_hourly_rate;                     
-        std::vector<ServiceType> m_specializations; 
+        ServiceTypeMask m_specializations;        // Cate un bit pentru fiecare tip de serviciu (ServiceTypeBit)
         
     protected:
         // Membri statici pentru ID-uri
@@ -43,8 +43,14 @@ namespace Beauty_Salon {
         // Setteri
         void SetHourlyRate(double rate);
         
+        // Specializarile angajatului ca masca de biti
+        ServiceTypeMask GetSpecializations() const { return m_specializations; }
+        
         // Verifica daca angajatul poate oferi un anumit tip de serviciu
-        bool CanProvide(ServiceType type) const;
+        bool CanProvide(ServiceType type) const { return (m_specializations & ServiceTypeBit(type)) != 0; }
+        
+        // Verifica daca angajatul poate oferi toate tipurile de servicii din masca
+        bool CanProvideAll(ServiceTypeMask types) const { return (m_specializations & types) == types; }
         
         // Afiseaza informatii despre angajat
         virtual void DisplayInfo() const;
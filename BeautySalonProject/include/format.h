@@ -0,0 +1,71 @@
+#ifndef FORMAT_H
+#define FORMAT_H
+
+#include "utils.h"
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace Beauty_Salon {
+    // Numarul maxim de caractere scrise de FormatTimeSlot ("Day 4294967295, 23:59 (65535 min)")
+    constexpr std::size_t TIME_SLOT_MAX_CHARS = 40;
+    
+    // Numarul maxim de caractere scrise de FormatInteger si FormatPrice
+    constexpr std::size_t NUMBER_MAX_CHARS = 32;
+    
+    // Functii de formatare care scriu intr-un buffer furnizat de apelant si intorc pointerul dupa ultimul caracter scris
+    char* FormatInteger(char* out, long long value);
+    
+    // Formateaza un numar real la fel ca std::ostream implicit (6 cifre semnificative)
+    char* FormatPrice(char* out, double value);
+    
+    // Formateaza un interval ca "HH:MM (D min)", cu prefixul "Day N, " pentru zilele diferite de 0
+    char* FormatTimeSlot(char* out, const TimeSlot& slot);
+    
+    // Buffer de text care foloseste o zona fixa (pe stiva) si trece pe heap doar la nevoie.
+    // Continutul poate fi scris intr-un stream cu un singur apel de write.
+    class TextBuffer {
+    private:
+        static constexpr std::size_t INLINE_CAPACITY = 256;
+        
+        char m_inline[INLINE_CAPACITY];
+        std::unique_ptr<char[]> m_heap;
+        char* m_data;
+        std::size_t m_size;
+        std::size_t m_capacity;
+        
+        // Asigura spatiu pentru inca `extra` caractere
+        void _Reserve(std::size_t extra);
+        
+    public:
+        TextBuffer();
+        TextBuffer(const TextBuffer&) = delete;
+        TextBuffer& operator=(const TextBuffer&) = delete;
+        
+        // Getteri
+        const char* Data() const { return m_data; }
+        std::size_t Size() const { return m_size; }
+        bool IsEmpty() const { return m_size == 0; }
+        
+        // Goleste bufferul pastrand capacitatea alocata
+        void Clear() { m_size = 0; }
+        
+        // Metode de adaugare
+        TextBuffer& Append(const char* text, std::size_t length);
+        TextBuffer& Append(const char* text);
+        TextBuffer& Append(const std::string& text);
+        TextBuffer& Append(char c);
+        TextBuffer& AppendInteger(long long value);
+        TextBuffer& AppendPrice(double value);
+        TextBuffer& AppendTimeSlot(const TimeSlot& slot);
+        
+        // Scrie continutul intr-un stream cu un singur apel
+        void WriteTo(std::ostream& os) const;
+        
+        // Copiaza continutul intr-un string
+        std::string ToString() const;
+    };
+}
+
+#endif // FORMAT_H
@@ -2,6 +2,8 @@
 #define INTERFACES_H
 
 namespace Beauty_Salon {
+    class Appointment;
+    
     // Interfata pentru obiecte care pot primi reduceri
     class IDiscountable {
     public:
@@ -22,6 +24,15 @@ namespace Beauty_Salon {
         // Verifica dacă actiunea necesita un specialist
         virtual bool RequiresSpecialist() const = 0;
     };
+
+    // Interfata pentru obiecte care inregistreaza consumul de produse al programarilor finalizate
+    class IConsumptionSink {
+    public:
+        virtual ~IConsumptionSink() = default;
+        
+        // Apelata de Appointment::Complete dupa ce programarea a fost marcata ca finalizata
+        virtual void OnAppointmentCompleted(const Appointment& appointment) = 0;
+    };
 }
 
 #endif // INTERFACES_H
\ No newline at end of file
@@ -0,0 +1,134 @@
+#ifndef INVENTORY_H
+#define INVENTORY_H
+
+#include "product.h"
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Rezervarea unei cantitati de produs pentru o programare
+    struct StockReservation {
+        int id;                 
+        int productId;          
+        int appointmentId;      
+        int quantity;           
+    };
+    
+    // Functie apelata cand stocul disponibil al unui produs scade sub pragul minim
+    using LowStockListener = std::function<void(const Product& product, int available)>;
+    
+    // Inventarul salonului: detine produsele, le indexeaza dupa ID, categorie, marca si furnizor
+    // si gestioneaza rezervarile de stoc facute pentru programari.
+    // Vanzarile de la case (Sell), reaprovizionarile si consumul pot rula pe mai multe fire in acelasi timp, in paralel
+    // cu un singur fir de back office care face rezervarile. Produsele, pragurile si ascultatorii se configureaza cand
+    // casele nu vand
+    class Inventory {
+    private:
+        std::vector<std::unique_ptr<Product>> m_products;                             
+        std::unordered_map<int, size_t> m_index_of;                                   // Pozitia fiecarui produs dupa ID
+        std::vector<Product*> m_by_category[PRODUCT_CATEGORY_COUNT];                  
+        std::unordered_map<std::string, std::vector<Product*>> m_by_brand;            
+        std::unordered_map<std::string, std::vector<Product*>> m_by_supplier;         // Doar produse profesionale
+        std::deque<std::atomic<int>> m_reserved;                                      // Cantitatea rezervata, per produs (citita de case)
+        std::vector<int> m_threshold;                                                 // Pragul de stoc minim, per produs
+        std::vector<size_t> m_low_position;                                           // Pozitia in m_low_stock sau NOT_LOW
+        std::vector<Product*> m_low_stock;                                            
+        std::mutex m_low_stock_mutex;                                                 // Protejeaza m_low_stock si m_low_position
+        std::unordered_map<int, StockReservation> m_reservations;                     
+        std::unordered_map<int, std::vector<int>> m_reservations_by_appointment;      
+        std::vector<LowStockListener> m_listeners;                                    
+        int m_default_threshold;                                                      
+        int m_next_reservation_id;                                                    
+        
+        static constexpr size_t NOT_LOW = static_cast<size_t>(-1);
+        
+        // Adauga produsul in indexurile dupa categorie, marca si furnizor
+        void _IndexProduct(Product* product);
+        
+        // Actualizeaza lista de produse cu stoc scazut si anunta ascultatorii la trecerea sub prag
+        void _UpdateLowStock(size_t index);
+        
+        // Scoate cantitatea din stocul nerezervat (compare-and-swap, sigur fata de alte case si de rezervari)
+        bool _TakeUnreserved(size_t index, int quantity);
+        
+        // Elimina rezervarea din lista programarii careia ii apartine
+        void _ForgetReservation(const StockReservation& reservation);
+        
+        // Pozitia produsului in m_products sau NOT_LOW daca nu exista
+        size_t _FindIndex(int productId) const;
+        
+    public:
+        Inventory();
+        explicit Inventory(int defaultThreshold);
+        Inventory(const Inventory&) = delete;
+        Inventory& operator=(const Inventory&) = delete;
+        
+        // Adauga un produs in inventar; intoarce nullptr daca exista deja un produs cu acelasi ID
+        Product* AddProduct(std::unique_ptr<Product> product);
+        
+        // Getteri
+        size_t GetProductCount() const;
+        const std::vector<std::unique_ptr<Product>>& GetProducts() const;
+        
+        // Cautari in O(1) (plus dimensiunea rezultatului)
+        Product* FindByID(int productId) const;
+        const std::vector<Product*>& FindByCategory(ProductCategory category) const;
+        const std::vector<Product*>& FindByBrand(const std::string& brand) const;
+        const std::vector<Product*>& FindBySupplier(const std::string& supplier) const;
+        
+        // Stocul disponibil (cantitatea din stoc minus cantitatea rezervata)
+        int GetAvailable(int productId) const;
+        int GetReserved(int productId) const;
+        bool IsAvailable(int productId, int quantity) const;
+        
+        // Adauga stoc pentru un produs
+        bool Restock(int productId, int quantity);
+        
+        // Scoate din stoc o cantitate consumata (fara rezervare prealabila), doar din stocul nerezervat
+        bool Consume(int productId, int quantity);
+        
+        // Vanzare la casa: scade stocul nerezervat si actualizeaza lista de stoc scazut; poate fi apelata in paralel
+        bool Sell(int productId, int quantity);
+        
+        // Rezerva stoc pentru o programare; intoarce ID-ul rezervarii sau 0 daca stocul nu ajunge
+        int Reserve(int productId, int quantity, int appointmentId);
+        
+        // Consuma stocul rezervat (produsul a fost folosit)
+        bool Commit(int reservationId);
+        
+        // Elibereaza stocul rezervat (programarea a fost anulata)
+        bool Release(int reservationId);
+        
+        // Consuma sau elibereaza toate rezervarile unei programari; intoarce numarul de rezervari procesate
+        int CommitAppointment(int appointmentId);
+        int ReleaseAppointment(int appointmentId);
+        
+        // Rezervarile active
+        const StockReservation* GetReservation(int reservationId) const;
+        size_t GetReservationCount() const;
+        
+        // Pragurile de stoc minim
+        int GetLowStockThreshold(int productId) const;
+        bool SetLowStockThreshold(int productId, int threshold);
+        void SetDefaultLowStockThreshold(int threshold);
+        
+        // Produsele cu stoc disponibil sub prag (lista intretinuta la fiecare modificare de stoc)
+        const std::vector<Product*>& GetLowStockProducts() const;
+        
+        // Inregistreaza o functie apelata cand un produs trece sub pragul de stoc minim (pe firul care a facut
+        // modificarea, cu lista de stoc scazut blocata: functia nu trebuie sa modifice inventarul)
+        void AddLowStockListener(LowStockListener listener);
+        
+        // Reconstruieste indexurile dupa categorie, marca si furnizor (daca produsele au fost modificate)
+        // si recalculeaza lista de produse cu stoc scazut
+        void Reindex();
+    };
+}
+
+#endif // INVENTORY_H
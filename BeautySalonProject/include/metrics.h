@@ -0,0 +1,147 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Operatiile masurate pe caile critice
+    enum class MetricOperation {
+        SCHEDULE_ADD,
+        SCHEDULE_REMOVE,
+        SCHEDULE_FIND,
+        SCHEDULE_SUGGEST,
+        SCHEDULE_REPORT,
+        APPOINTMENT_PRICE,
+        PRODUCT_UPDATE_STOCK,
+        COUNT
+    };
+    
+    // Motivele pentru care o operatie a fost refuzata
+    enum class RejectionReason {
+        OUTSIDE_WORKING_HOURS,      // Intervalul iese din programul salonului
+        EMPLOYEE_CONFLICT,          // Angajatul ales are deja o programare suprapusa
+        CAPACITY,                   // S-a atins numarul maxim de programari simultane
+        OFF_SHIFT,                  // Angajatul ales nu este in tura
+        NO_EMPLOYEE,                // Niciun angajat din tura nu poate lua programarea
+        INSUFFICIENT_STOCK,         // Stocul produsului ar deveni negativ
+        COUNT
+    };
+    
+    constexpr size_t METRIC_OPERATION_COUNT = static_cast<size_t>(MetricOperation::COUNT);
+    constexpr size_t REJECTION_REASON_COUNT = static_cast<size_t>(RejectionReason::COUNT);
+    
+    // Numele folosite la export ("schedule.add", "outside_working_hours")
+    const char* GetOperationName(MetricOperation operation);
+    const char* GetRejectionName(RejectionReason reason);
+    
+    struct ThreadMetrics;
+    
+    // Histograma de latente in stil HDR: valori exacte sub 32 ns, apoi fiecare putere a lui 2 impartita in 32 de
+    // intervale egale (eroare relativa sub 3.2%), pana la 2^41 ns (~36 de minute); valorile mai mari intra in ultimul interval
+    class LatencyHistogram {
+    public:
+        static constexpr int SUB_BUCKET_BITS = 5;
+        static constexpr int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+        static constexpr int MAX_EXPONENT = 40;
+        static constexpr size_t BUCKET_COUNT = SUB_BUCKET_COUNT + (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+        
+        // Intervalul in care intra o valoare si cea mai mare valoare din interval
+        static size_t BucketIndex(std::uint64_t value);
+        static std::uint64_t BucketUpperBound(size_t index);
+        
+    private:
+        std::vector<std::uint64_t> m_buckets;
+        std::uint64_t m_count;
+        std::uint64_t m_sum;
+        std::uint64_t m_min;
+        std::uint64_t m_max;
+        
+        // Contoarele unui fir se aduna direct in histograma agregata
+        friend struct ThreadMetrics;
+        
+    public:
+        LatencyHistogram();
+        
+        void Record(std::uint64_t nanoseconds);
+        void Merge(const LatencyHistogram& other);
+        void Clear();
+        
+        // Getteri
+        std::uint64_t GetCount() const;
+        std::uint64_t GetMin() const;
+        std::uint64_t GetMax() const;
+        std::uint64_t GetMean() const;
+        
+        // Valoarea sub care se afla procentul dat din masuratori (0..100), cu precizia intervalelor
+        std::uint64_t GetPercentile(double percent) const;
+    };
+    
+    // Starea agregata a contoarelor, pe toate firele
+    struct MetricsSnapshot {
+        bool enabled;                                                   // Programul a fost compilat cu SALON_METRICS
+        size_t threadCount;                                             // Fire care au inregistrat ceva (inclusiv cele oprite)
+        std::vector<LatencyHistogram> latency;                          // Pe operatii (MetricOperation)
+        std::array<std::uint64_t, METRIC_OPERATION_COUNT> operationAllocations;   // Alocari facute in timpul operatiilor
+        std::array<std::uint64_t, REJECTION_REASON_COUNT> rejections;
+        std::uint64_t allocations;                                      // Toate alocarile prin operator new
+        std::uint64_t allocatedBytes;
+        
+        MetricsSnapshot();
+    };
+    
+    // Contoarele sunt tinute separat pe fiecare fir (fara sincronizare la inregistrare) si adunate doar la TakeSnapshot.
+    // Contoarele firelor oprite se pastreaza. Instrumentarea se activeaza compiland cu -DSALON_METRICS; fara ea,
+    // macro-urile de mai jos nu genereaza cod, iar TakeSnapshot intoarce o stare goala
+    class Metrics {
+    public:
+        static constexpr bool IsEnabled() {
+#ifdef SALON_METRICS
+            return true;
+#else
+            return false;
+#endif
+        }
+        
+        static void RecordLatency(MetricOperation operation, std::uint64_t nanoseconds, std::uint64_t allocations);
+        static void RecordRejection(RejectionReason reason);
+        
+        // Aduna contoarele tuturor firelor
+        static MetricsSnapshot TakeSnapshot();
+        
+        // Reseteaza contoarele (operatiile aflate in desfasurare pe alte fire pot fi pierdute sau numarate partial)
+        static void Reset();
+    };
+    
+    // Masoara durata si alocarile unei operatii, de la constructie pana la distrugere
+    class ScopedOperationTimer {
+    private:
+        MetricOperation m_operation;
+        ThreadMetrics* m_metrics;
+        std::uint64_t m_allocations;
+        std::chrono::steady_clock::time_point m_start;
+        
+    public:
+        explicit ScopedOperationTimer(MetricOperation operation);
+        ~ScopedOperationTimer();
+        ScopedOperationTimer(const ScopedOperationTimer&) = delete;
+        ScopedOperationTimer& operator=(const ScopedOperationTimer&) = delete;
+    };
+}
+
+#ifdef SALON_METRICS
+#define SALON_METRICS_CONCAT_(a, b) a##b
+#define SALON_METRICS_CONCAT(a, b) SALON_METRICS_CONCAT_(a, b)
+#define SALON_MEASURE(operation) \
+    ::Beauty_Salon::ScopedOperationTimer SALON_METRICS_CONCAT(salonMetricsTimer, __LINE__)(::Beauty_Salon::MetricOperation::operation)
+#define SALON_COUNT_REJECTION(reason) \
+    ::Beauty_Salon::Metrics::RecordRejection(::Beauty_Salon::RejectionReason::reason)
+#else
+#define SALON_MEASURE(operation) ((void)0)
+#define SALON_COUNT_REJECTION(reason) ((void)0)
+#endif
+
+#endif // METRICS_H
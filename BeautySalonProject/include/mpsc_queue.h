@@ -0,0 +1,117 @@
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Beauty_Salon {
+    // Coada circulara marginita, cu mai multi producatori si un singur consumator (algoritmul lui Vyukov).
+    // Fiecare celula are un numar de secventa: producatorii isi rezerva pozitia cu un CAS si publica valoarea
+    // setand secventa, iar consumatorul citeste celula doar dupa ce secventa o marcheaza ca plina. Fara mutex-uri
+    template <typename T>
+    class BoundedMpscQueue {
+    private:
+        struct Cell {
+            std::atomic<std::size_t> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];     // Valoarea este construita doar cat timp celula e plina
+            
+            T* Value() { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+        
+        std::unique_ptr<Cell[]> m_cells;
+        std::size_t m_mask;                             // Capacitatea - 1 (capacitatea este o putere a lui 2)
+        alignas(64) std::atomic<std::size_t> m_enqueue_pos;
+        alignas(64) std::size_t m_dequeue_pos;          // Folosit doar de consumator
+        
+        static std::size_t _RoundUpToPowerOfTwo(std::size_t value) {
+            std::size_t result = 2;
+            while (result < value) {
+                result <<= 1;
+            }
+            return result;
+        }
+        
+    public:
+        explicit BoundedMpscQueue(std::size_t capacity)
+            : m_cells(new Cell[_RoundUpToPowerOfTwo(capacity)]), m_mask(_RoundUpToPowerOfTwo(capacity) - 1),
+              m_enqueue_pos(0), m_dequeue_pos(0) {
+            for (std::size_t i = 0; i <= m_mask; ++i) {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+        
+        BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+        BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+        
+        ~BoundedMpscQueue() {
+            // Distrugem valorile ramase in coada
+            ConsumeBatch(GetCapacity(), [](T&&) {});
+        }
+        
+        std::size_t GetCapacity() const { return m_mask + 1; }
+        
+        // Adauga o valoare; intoarce false (fara a muta valoarea) daca coada este plina. Poate fi apelata din orice fir
+        bool TryPush(T&& value) {
+            std::size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            Cell* cell;
+            while (true) {
+                cell = &m_cells[pos & m_mask];
+                std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+                if (diff == 0) {
+                    // Celula e libera pentru aceasta pozitie; o rezervam
+                    if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    // Consumatorul nu a eliberat inca celula de acum o tura: coada este plina
+                    return false;
+                } else {
+                    pos = m_enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+            
+            new (cell->storage) T(std::move(value));
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+        
+        // Scoate cel mult maxCount valori, in ordine, si apeleaza consumer(T&&) pentru fiecare.
+        // Intoarce numarul de valori scoase. Doar din firul consumator
+        template <typename Consumer>
+        std::size_t ConsumeBatch(std::size_t maxCount, Consumer&& consumer) {
+            std::size_t count = 0;
+            while (count < maxCount) {
+                Cell* cell = &m_cells[m_dequeue_pos & m_mask];
+                if (cell->sequence.load(std::memory_order_acquire) != m_dequeue_pos + 1) {
+                    break;
+                }
+                
+                consumer(std::move(*cell->Value()));
+                cell->Value()->~T();
+                // Celula devine libera pentru producatorul din tura urmatoare
+                cell->sequence.store(m_dequeue_pos + m_mask + 1, std::memory_order_release);
+                ++m_dequeue_pos;
+                ++count;
+            }
+            return count;
+        }
+        
+        // Scoate urmatoarea valoare; intoarce false daca coada este goala. Doar din firul consumator
+        bool TryPop(T& value) {
+            return ConsumeBatch(1, [&value](T&& item) { value = std::move(item); }) == 1;
+        }
+        
+        // Verifica daca urmatoarea celula de citit este plina. Doar din firul consumator
+        bool IsEmpty() const {
+            const Cell* cell = &m_cells[m_dequeue_pos & m_mask];
+            return cell->sequence.load(std::memory_order_acquire) != m_dequeue_pos + 1;
+        }
+    };
+}
+
+#endif // MPSC_QUEUE_H
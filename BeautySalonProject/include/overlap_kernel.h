@@ -0,0 +1,63 @@
+#ifndef OVERLAP_KERNEL_H
+#define OVERLAP_KERNEL_H
+
+#include "utils.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Intervale stocate ca structura de tablouri (minute absolute de start si de final, pe 32 de biti),
+    // pentru a putea testa un interval fata de toate intervalele intr-o singura trecere. Minutele sunt exacte pentru
+    // zilele TimeSlot::MIN_DAY..MAX_DAY; in afara lor sunt saturate (nu se mai intorc in domeniu)
+    struct PackedIntervals {
+        std::vector<std::int32_t> starts;
+        std::vector<std::int32_t> ends;
+        
+        std::size_t Size() const { return starts.size(); }
+        void Clear();
+        void Reserve(std::size_t count);
+        void PushBack(const TimeSlot& slot);
+        void Set(std::size_t index, const TimeSlot& slot);
+        void Insert(std::size_t index, const TimeSlot& slot);
+        void Erase(std::size_t index);
+    };
+    
+    // Numara intervalele [starts[i], ends[i]) care se suprapun cu [queryStart, queryEnd)
+    std::size_t CountOverlaps(std::int32_t queryStart, std::int32_t queryEnd,
+                              const std::int32_t* starts, const std::int32_t* ends, std::size_t count);
+    
+    // Scrie in mask un bit pentru fiecare interval suprapus (mask trebuie sa aiba (count + 63) / 64 cuvinte)
+    // si intoarce numarul de suprapuneri
+    std::size_t ComputeOverlapMask(std::int32_t queryStart, std::int32_t queryEnd,
+                                   const std::int32_t* starts, const std::int32_t* ends, std::size_t count,
+                                   std::uint64_t* mask);
+    
+    // Variante pentru intervale impachetate si un TimeSlot
+    std::size_t CountOverlaps(const TimeSlot& slot, const PackedIntervals& intervals);
+    std::size_t ComputeOverlapMask(const TimeSlot& slot, const PackedIntervals& intervals, std::vector<std::uint64_t>& mask);
+    
+    // Implementarile concrete ale nucleului, expuse pentru benchmark
+    namespace OverlapKernel {
+        std::size_t CountScalar(std::int32_t queryStart, std::int32_t queryEnd,
+                                const std::int32_t* starts, const std::int32_t* ends, std::size_t count);
+        std::size_t MaskScalar(std::int32_t queryStart, std::int32_t queryEnd,
+                               const std::int32_t* starts, const std::int32_t* ends, std::size_t count,
+                               std::uint64_t* mask);
+        
+        // Varianta AVX2 (disponibila doar daca procesorul o suporta, vezi HasAvx2)
+        std::size_t CountAvx2(std::int32_t queryStart, std::int32_t queryEnd,
+                              const std::int32_t* starts, const std::int32_t* ends, std::size_t count);
+        std::size_t MaskAvx2(std::int32_t queryStart, std::int32_t queryEnd,
+                             const std::int32_t* starts, const std::int32_t* ends, std::size_t count,
+                             std::uint64_t* mask);
+        
+        // Verifica la rulare daca procesorul suporta AVX2
+        bool HasAvx2();
+        
+        // Numele variantei selectate la rulare ("avx2" sau "scalar")
+        const char* ActiveKernelName();
+    }
+}
+
+#endif // OVERLAP_KERNEL_H
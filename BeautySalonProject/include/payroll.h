@@ -0,0 +1,59 @@
+#ifndef PAYROLL_H
+#define PAYROLL_H
+
+#include "appointment.h"
+#include "employee.h"
+#include "report.h"
+#include "task_pool.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Regula de comision: procent din venitul adus de serviciile de anumite tipuri,
+    // aplicat angajatilor cu rolul dat (sau tuturor) care ating un venit minim pe perioada
+    struct CommissionRule {
+        std::string name;               
+        ServiceTypeMask serviceTypes;   // Tipurile de servicii la care se aplica
+        std::string role;               // Rolul angajatului ("Stylist", "Technician"); gol = orice rol
+        double percent;                 
+        double minPeriodRevenue;        // Venitul minim al angajatului pe perioada pentru a primi comisionul
+        
+        CommissionRule();
+        CommissionRule(const std::string& ruleName, ServiceTypeMask types, double rulePercent);
+    };
+    
+    // Calculeaza statul de plata (ore lucrate x tarif orar + comisioane) pentru o perioada.
+    // Angajatii sunt impartiti in blocuri executate de pool; fiecare linie este calculata de o singura sarcina,
+    // iar totalurile sunt adunate in ordinea angajatilor, deci rezultatul nu depinde de numarul de fire
+    class PayrollEngine {
+    private:
+        std::vector<CommissionRule> m_rules;        
+        TaskPool* m_task_pool;                      // nullptr = pool-ul comun
+        
+        // Calculeaza linia unui angajat din programarile sale finalizate in perioada
+        PayrollEntry _ComputeEntry(const Employee& employee, const std::vector<const Appointment*>& appointments) const;
+        
+    public:
+        PayrollEngine();
+        
+        // Regulile de comision
+        void AddCommissionRule(const CommissionRule& rule);
+        const std::vector<CommissionRule>& GetCommissionRules() const;
+        void ClearCommissionRules();
+        
+        // Pool-ul pe care se calculeaza liniile (nullptr = TaskPool::GetDefault())
+        TaskPool* GetTaskPool() const;
+        void SetTaskPool(TaskPool* pool);
+        
+        // Statul de plata pentru zilele [firstDay, lastDay]; sunt platite doar programarile finalizate
+        PayrollReport Compute(const std::vector<Appointment>& appointments, 
+                              const std::vector<const Employee*>& employees, 
+                              int firstDay, int lastDay) const;
+    };
+    
+    // Regulile de comision folosite implicit de salon
+    std::vector<CommissionRule> CreateStandardCommissionRules();
+}
+
+#endif // PAYROLL_H
@@ -0,0 +1,109 @@
+#ifndef PRICING_H
+#define PRICING_H
+
+#include "utils.h"
+#include "small_vector.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Beauty_Salon {
+    // Regulile de pret ale unui serviciu, compilate intr-o inregistrare plata atunci cand ruleaza setterii.
+    // Pretul final este basePrice * multiplier + surcharge.
+    struct PriceRecord {
+        double basePrice;       
+        double multiplier;      // Factor multiplicativ (gel, premium, numar de unghii)
+        double surcharge;       // Adaos fix (spalat, coafat, camera speciala)
+        double price;           // Pretul final, precalculat
+        int duration;           // Durata in minute
+        ServiceType type;       
+        
+        PriceRecord();
+        PriceRecord(double base, double mult, double extra, int dur, ServiceType serviceType);
+    };
+    
+    // O linie dintr-o cerere de pret in lot: inregistrarea serviciului si discount-ul clientului (procent)
+    struct PriceQuoteLine {
+        const PriceRecord* record;
+        double discountRate;
+    };
+    
+    // Motor de pret care citeste inregistrarile precompilate fara apeluri virtuale
+    class PricingEngine {
+    public:
+        // Pretul unei singure linii, cu discount-ul clientului aplicat
+        static double Quote(const PriceRecord& record, double discountRate) {
+            return record.price * (1.0 - discountRate / 100.0);
+        }
+        
+        // Calculeaza pretul pentru fiecare linie (in prices, daca nu e nullptr) si intoarce totalul
+        static double QuoteBatch(const PriceQuoteLine* lines, std::size_t count, double* prices);
+        
+        // Totalul unui pachet de inregistrari, cu discount-ul pachetului aplicat (procent)
+        static double QuotePackage(const PriceRecord* const* records, std::size_t count, double packageDiscount);
+        
+        // Durata totala a unui pachet de inregistrari
+        static int TotalDuration(const PriceRecord* const* records, std::size_t count);
+    };
+    
+    // Epoca globala a preturilor: creste la orice modificare de pret sau durata a unui serviciu sau produs.
+    // Cat timp epoca nu s-a schimbat, niciun total memorat nu poate fi invalid
+    class PriceEpoch {
+    public:
+        static std::uint64_t Get();
+        static void Advance();
+    };
+    
+    // Totalurile memorate ale unui pachet (pret si durata), impreuna cu versiunile membrilor din momentul calculului.
+    // Verificarea costa O(1) daca epoca globala nu s-a schimbat, altfel O(n) comparatii de versiuni (fara apeluri virtuale)
+    template <std::size_t N>
+    class MemoizedTotals {
+    private:
+        std::uint64_t m_epoch;                          
+        SmallVector<std::uint32_t, N> m_versions;       
+        double m_price;                                 
+        int m_minutes;                                  
+        bool m_valid;                                   
+        
+    public:
+        MemoizedTotals() : m_epoch(0), m_price(0.0), m_minutes(0), m_valid(false) {
+        }
+        
+        void Invalidate() { m_valid = false; }
+        double GetPrice() const { return m_price; }
+        int GetMinutes() const { return m_minutes; }
+        
+        // version(i) intoarce versiunea curenta a membrului i
+        template <typename VersionFn>
+        bool IsValid(std::size_t count, VersionFn version) {
+            if (!m_valid || m_versions.Size() != count) {
+                return false;
+            }
+            std::uint64_t epoch = PriceEpoch::Get();
+            if (epoch == m_epoch) {
+                return true;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                if (m_versions[i] != version(i)) {
+                    return false;
+                }
+            }
+            // Modificarea a fost la alt obiect; totalurile raman valabile pentru noua epoca
+            m_epoch = epoch;
+            return true;
+        }
+        
+        template <typename VersionFn>
+        void Store(double price, int minutes, std::size_t count, VersionFn version) {
+            m_epoch = PriceEpoch::Get();
+            m_versions.Clear();
+            for (std::size_t i = 0; i < count; ++i) {
+                m_versions.PushBack(version(i));
+            }
+            m_price = price;
+            m_minutes = minutes;
+            m_valid = true;
+        }
+    };
+}
+
+#endif // PRICING_H
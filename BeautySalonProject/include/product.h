@@ -2,8 +2,14 @@
 #define PRODUCT_H
 
 #include "interfaces.h"
+#include "format.h"
+#include "report.h"
+#include "small_vector.h"
+#include "pricing.h"
+#include <atomic>
 #include <string>
 #include <vector>
+#include <memory>
 
 namespace Beauty_Salon {
     // Enumeratie pentru categoria produsului
@@ -16,6 +22,12 @@ namespace Beauty_Salon {
         OTHER           
     };
     
+    // Numarul de categorii de produse (folosit pentru indexuri pe categorie)
+    constexpr int PRODUCT_CATEGORY_COUNT = static_cast<int>(ProductCategory::OTHER) + 1;
+    
+    // Reducerea (procent) aplicata produselor marcate ca fiind la reducere
+    constexpr double PRODUCT_SALE_DISCOUNT = 15.0;
+    
     // Clasa de bază pentru toate produsele din salon
     class Product : public IDiscountable {
     private:
@@ -23,26 +35,32 @@ namespace Beauty_Salon {
         std::string m_name;           
         std::string m_brand;          
         double m_price;               
-        int m_quantity;               
+        std::atomic<int> m_quantity;  // Actualizat cu compare-and-swap (mai multe case de marcat simultan)
         ProductCategory m_category;   
         std::string m_description;    
         bool m_is_on_sale;            
+        std::uint32_t m_version;      // Creste la fiecare modificare care schimba pretul final
         
     protected:
         // Membri statici
         static int m_next_id;        
         static int GenerateID();     
         
+        // Marcheaza modificarea pretului (invalideaza totalurile memorate ale pachetelor)
+        void _Touch();
+        
     public:
         // Constructori si destructor
         Product();
         Product(const std::string& name, double price);
         Product(const std::string& name, const std::string& brand, double price, ProductCategory category);
+        Product(const Product& other);
+        Product& operator=(const Product& other);
         virtual ~Product();
         
         // Getteri
         int GetID() const;
-        std::string GetName() const;
+        const std::string& GetName() const;
         std::string GetBrand() const;
         double GetPrice() const;
         int GetQuantity() const;
@@ -50,6 +68,9 @@ namespace Beauty_Salon {
         std::string GetDescription() const;
         bool IsOnSale() const;
         
+        // Versiunea pretului, folosita pentru invalidarea totalurilor memorate
+        std::uint32_t GetVersion() const { return m_version; }
+        
         // Setteri
         void SetName(const std::string& name);
         void SetBrand(const std::string& brand);
@@ -59,21 +80,31 @@ namespace Beauty_Salon {
         void SetDescription(const std::string& description);
         void SetOnSale(bool onSale);
         
-        // Actualizeaza stocul produsului
+        // Actualizeaza stocul produsului; sigur la apeluri concurente (fara blocare globala),
+        // stocul nu poate deveni negativ, iar actualizarile nu se pierd
         bool UpdateStock(int quantity);
         
+        // La fel, dar o scadere nu poate duce stocul sub minimum (de exemplu sub cantitatea rezervata)
+        bool UpdateStock(int quantity, int minimum);
+        
         // Verifica daca produsul este în stoc
         bool IsInStock() const;
         
         // Implementarea metodei din interfața IDiscountable
         virtual double ApplyDiscount(double amount) override;
         
+        // Calculeaza pretul de lista al produsului (fara reducerea de sold, dar cu adaosuri)
+        virtual double CalculateListPrice() const;
+        
         // Calculeaza pretul final al produsului (inclusiv reduceri)
         virtual double CalculateFinalPrice() const;
         
         // Afiseaza informatii despre produs
         virtual void DisplayInfo() const;
         
+        // Scrie descrierea scurta a produsului in buffer (acelasi format ca operatorul <<)
+        void FormatTo(TextBuffer& out) const;
+        
         // Supraincarcarea operatorului de afisare
         friend std::ostream& operator<<(std::ostream& os, const Product& product);
     };
@@ -99,6 +130,7 @@ namespace Beauty_Salon {
         void SetTesterAvailable(bool available);
         
         // Implementari ale metodelor virtuale
+        virtual double CalculateListPrice() const override;
         virtual double CalculateFinalPrice() const override;
         virtual void DisplayInfo() const override;
     };
@@ -126,13 +158,20 @@ namespace Beauty_Salon {
         void SetSupplier(const std::string& supplier);
         void SetRequiresCertification(bool requires);
         
+        // Numarul de utilizari dupa care o unitate de produs trebuie inlocuita
+        static constexpr int USES_PER_UNIT = 500;
+        
         // Incrementeaza contorul de utilizari
         void IncrementUsage();
         
+        // Adauga mai multe utilizari deodata (aplicarea unui lot de consum)
+        void AddUsage(int uses);
+        
         // Verifica dacă produsul trebuie inlocuit
         bool NeedsReplacement() const;
         
         // Implementari ale metodelor virtuale
+        virtual double CalculateListPrice() const override;
         virtual double CalculateFinalPrice() const override;
         virtual void DisplayInfo() const override;
     };
@@ -140,19 +179,36 @@ namespace Beauty_Salon {
     // Pachet de produse (pentru demonstrarea operatorului +)
     class ProductBundle {
     private:
+        // Numarul de produse stocate fara alocare pe heap (pachetele obisnuite au 2-6 produse)
+        static constexpr size_t INLINE_ITEMS = 6;
+        
         std::string m_name;                   
-        std::vector<Product*> m_products;     
+        SmallVector<const Product*, INLINE_ITEMS> m_products;     // Produsele sunt detinute de inventar (adrese stabile)
         double m_bundle_discount;             
+        mutable MemoizedTotals<INLINE_ITEMS> m_totals;            // Pretul total, invalidat de versiunile produselor
         
     public:
         // Constructori si destructor
         ProductBundle();
         ProductBundle(const std::string& name);
         ProductBundle(const std::string& name, double bundleDiscount);
+        ProductBundle(const ProductBundle&) = default;
+        ProductBundle(ProductBundle&&) = default;
+        ProductBundle& operator=(const ProductBundle&) = default;
+        ProductBundle& operator=(ProductBundle&&) = default;
         ~ProductBundle();
         
         // Adauga un produs in pachet
-        void AddProduct(Product* product);
+        void AddProduct(const Product* product);
+        
+        // Getteri
+        size_t GetProductCount() const;
+        const Product* GetProduct(size_t index) const;
+        const std::string& GetName() const;
+        double GetBundleDiscount() const;
+        
+        // Adauga un produs in pachet (folosit de operatorul + la inlantuire)
+        ProductBundle& operator+=(const Product& product);
         
         // Calculeaza pretul total al pachetului (inclusiv discount)
         double CalculateTotalPrice() const;
@@ -160,12 +216,20 @@ namespace Beauty_Salon {
         // Afiseaza informatii despre pachet
         void DisplayBundleInfo() const;
         
+        // Calculeaza descrierea pachetului ca structura, pentru a fi scrisa cu ReportWriter
+        BundleReport BuildReport() const;
+        
         // Supraincarcarea operatorului de afisare
         friend std::ostream& operator<<(std::ostream& os, const ProductBundle& bundle);
     };
 
-    // Operator pentru combinarea produselor intr-un pachet
+    // Scrie lista numerotata a produselor in buffer, pentru afisarea cu un singur apel de write
+    void RenderProductList(TextBuffer& out, const std::vector<std::unique_ptr<Product>>& products);
+
+    // Operatori pentru combinarea produselor intr-un pachet; a + b + c adauga in acelasi pachet temporar
     ProductBundle operator+(const Product& lhs, const Product& rhs);
+    ProductBundle operator+(ProductBundle&& bundle, const Product& product);
+    ProductBundle operator+(const ProductBundle& bundle, const Product& product);
 }
 
 #endif // PRODUCT_H
@@ -0,0 +1,52 @@
+#ifndef QUALIFICATION_MATRIX_H
+#define QUALIFICATION_MATRIX_H
+
+#include "employee.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Matricea de calificari a salonului: pentru fiecare tip de serviciu, un bitset cu cate un bit per angajat.
+    // Angajatii care pot face mai multe tipuri de servicii se obtin printr-un AND intre randurile tipurilor
+    class QualificationMatrix {
+    private:
+        std::vector<Employee*> m_employees;                         // Coloana i a matricei este angajatul i
+        std::vector<std::uint64_t> m_rows[SERVICE_TYPE_COUNT];      
+        size_t m_word_count;                                        
+        
+        // Seteaza bitii coloanei dupa specializarile angajatului
+        void _SetColumn(size_t column, ServiceTypeMask specializations);
+        
+    public:
+        QualificationMatrix();
+        
+        // Construieste matricea pentru o lista de angajati
+        void Build(const std::vector<std::unique_ptr<Employee>>& employees);
+        void Build(const std::vector<Employee*>& employees);
+        
+        // Adauga un angajat ca o coloana noua
+        void AddEmployee(Employee* employee);
+        
+        // Recalculeaza coloana unui angajat dupa modificarea specializarilor; false daca nu este in matrice
+        bool Refresh(const Employee* employee);
+        
+        // Getteri
+        size_t GetEmployeeCount() const;
+        size_t GetWordCount() const;
+        Employee* GetEmployee(size_t column) const;
+        const std::uint64_t* GetRow(ServiceType type) const;
+        
+        // Scrie in result bitset-ul angajatilor care pot face toate tipurile din masca (GetWordCount cuvinte)
+        // si intoarce numarul lor
+        size_t Match(ServiceTypeMask types, std::vector<std::uint64_t>& result) const;
+        
+        // Numarul, respectiv lista angajatilor care pot face toate tipurile din masca
+        size_t CountQualified(ServiceTypeMask types) const;
+        std::vector<Employee*> FindQualified(ServiceTypeMask types) const;
+        void FindQualified(ServiceTypeMask types, std::vector<Employee*>& result) const;
+    };
+}
+
+#endif // QUALIFICATION_MATRIX_H
@@ -0,0 +1,156 @@
+#ifndef REPORT_H
+#define REPORT_H
+
+#include "utils.h"
+#include "format.h"
+#include "metrics.h"
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Formatele in care poate fi scris un raport
+    enum class ReportFormat {
+        TEXT,       // Formatul pentru oameni, identic cu afisarea din consola
+        JSON,       // Un obiect JSON pe linie (JSON Lines)
+        CSV         
+    };
+    
+    // Numarul de programari pe fiecare stare
+    struct StatusBreakdown {
+        int scheduled = 0;
+        int inProgress = 0;
+        int completed = 0;
+        int cancelled = 0;
+        int noShow = 0;
+        
+        // Incrementeaza contorul pentru o stare
+        void Add(AppointmentStatus status);
+    };
+    
+    // Raportul zilnic (GenerateDailyReport)
+    struct DailyReport {
+        int date = 0;
+        int totalAppointments = 0;
+        double totalRevenue = 0.0;
+        std::vector<std::pair<std::string, int>> services;  // Nume serviciu -> numar programari, sortat dupa nume
+        StatusBreakdown status;
+    };
+    
+    // Raportul pentru un angajat (GenerateEmployeeReport)
+    struct EmployeeReport {
+        int employeeId = 0;
+        std::string employeeName;
+        int totalAppointments = 0;
+        double totalRevenue = 0.0;
+        int totalMinutes = 0;
+    };
+    
+    // O linie din programul zilei
+    struct ScheduleEntry {
+        int appointmentId = 0;
+        std::string clientName;
+        std::string serviceName;
+        TimeSlot timeSlot;
+        AppointmentStatus status = AppointmentStatus::SCHEDULED;
+        double totalPrice = 0.0;
+    };
+    
+    // Programul unei zile (DisplayDailySchedule)
+    struct ScheduleReport {
+        int date = 0;
+        std::vector<ScheduleEntry> entries;
+    };
+    
+    // Un element (serviciu sau produs) dintr-un pachet
+    struct PackageItem {
+        std::string name;
+        double price = 0.0;
+        int minutes = 0;
+    };
+    
+    // Pachet de servicii (DisplayPackageInfo)
+    struct PackageReport {
+        std::string name;
+        double discount = 0.0;
+        std::vector<PackageItem> items;
+        double totalPrice = 0.0;
+        int totalMinutes = 0;
+    };
+    
+    // Pachet de produse (DisplayBundleInfo)
+    struct BundleReport {
+        std::string name;
+        double discount = 0.0;
+        std::vector<PackageItem> items;
+        double totalPrice = 0.0;
+    };
+    
+    // Plata unui angajat pe o perioada
+    struct PayrollEntry {
+        int employeeId = 0;
+        std::string employeeName;
+        int completedAppointments = 0;
+        int workedMinutes = 0;
+        double revenue = 0.0;
+        double hourlyPay = 0.0;
+        double commission = 0.0;
+        double totalPay = 0.0;
+    };
+    
+    // Statul de plata pe perioada [firstDay, lastDay]
+    struct PayrollReport {
+        int firstDay = 0;
+        int lastDay = 0;
+        std::vector<PayrollEntry> entries;
+        double totalHourlyPay = 0.0;
+        double totalCommission = 0.0;
+        double totalPay = 0.0;
+    };
+    
+    // Numele starii unei programari, pentru afisare ("Scheduled") si in format scurt ("SCH")
+    const char* GetStatusName(AppointmentStatus status);
+    const char* GetStatusCode(AppointmentStatus status);
+    
+    // Scrie rapoarte intr-un buffer reutilizabil. Bufferul isi pastreaza capacitatea intre rapoarte,
+    // asa ca generarea repetata a rapoartelor nu mai aloca memorie dupa primele apeluri.
+    class ReportWriter {
+    private:
+        ReportFormat m_format;
+        TextBuffer m_buffer;
+        
+        // Scrie un string ca literal JSON sau camp CSV
+        void _AppendString(const std::string& value);
+        
+        // Scrie o pereche "cheie": valoare in obiectul JSON curent
+        void _AppendJsonKey(const char* key, bool first);
+        
+    public:
+        ReportWriter();
+        explicit ReportWriter(ReportFormat format);
+        
+        // Getteri si setteri
+        ReportFormat GetFormat() const;
+        void SetFormat(ReportFormat format);
+        const TextBuffer& GetBuffer() const;
+        
+        // Metode pentru scrierea rapoartelor
+        void Write(const DailyReport& report);
+        void Write(const EmployeeReport& report);
+        void Write(const std::vector<EmployeeReport>& reports);
+        void Write(const ScheduleReport& report);
+        void Write(const PackageReport& report);
+        void Write(const BundleReport& report);
+        void Write(const PayrollReport& report);
+        void Write(const MetricsSnapshot& snapshot);
+        
+        // Goleste bufferul pastrand memoria alocata
+        void Clear();
+        
+        // Scrie continutul intr-un stream cu un singur apel si goleste bufferul
+        void FlushTo(std::ostream& os);
+    };
+}
+
+#endif // REPORT_H
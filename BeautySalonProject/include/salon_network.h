@@ -0,0 +1,121 @@
+#ifndef SALON_NETWORK_H
+#define SALON_NETWORK_H
+
+#include "schedule.h"
+#include "service_catalog.h"
+#include "shift_calendar.h"
+#include "task_pool.h"
+#include "employee.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Pozitia geografica a unei filiale (grade)
+    struct GeoPoint {
+        double latitude;
+        double longitude;
+        
+        GeoPoint();
+        GeoPoint(double lat, double lon);
+    };
+    
+    // Distanta pe suprafata Pamantului intre doua puncte, in kilometri (formula haversine)
+    double DistanceKm(const GeoPoint& a, const GeoPoint& b);
+    
+    // O filiala a salonului: are propriul program, catalog de servicii, angajati si ture
+    class Branch {
+    private:
+        int m_id;
+        std::string m_name;
+        GeoPoint m_location;
+        std::vector<std::unique_ptr<Employee>> m_employees;
+        ServiceCatalog m_catalog;
+        ShiftRoster m_roster;
+        Schedule m_schedule;
+        
+    public:
+        Branch(int id, const std::string& name, const GeoPoint& location);
+        Branch(const Branch&) = delete;
+        Branch& operator=(const Branch&) = delete;
+        
+        // Getteri
+        int GetID() const;
+        const std::string& GetName() const;
+        const GeoPoint& GetLocation() const;
+        
+        // Serviciile si angajatii filialei (detinuti de filiala)
+        Service* AddService(std::unique_ptr<Service> service);
+        Employee* AddEmployee(std::unique_ptr<Employee> employee);
+        const std::vector<std::unique_ptr<Employee>>& GetEmployees() const;
+        
+        // Recalculeaza angajatii calificati dupa adaugarea de servicii sau angajati
+        void RebuildQualifications();
+        
+        // Turele sunt folosite de program doar dupa apelul EnableShifts
+        void EnableShifts();
+        ShiftRoster& GetRoster();
+        
+        ServiceCatalog& GetCatalog();
+        const ServiceCatalog& GetCatalog() const;
+        Schedule& GetSchedule();
+        const Schedule& GetSchedule() const;
+    };
+    
+    // Un interval liber gasit intr-o filiala
+    struct SlotOffer {
+        int branchId;
+        double distanceKm;      // Distanta de la punctul cautarii la filiala
+        Service* service;       // Serviciul din catalogul filialei
+        TimeSlot slot;
+        
+        SlotOffer();
+    };
+    
+    // Ordinea ofertelor: intai cele mai devreme, apoi cele mai apropiate, apoi dupa ID-ul filialei
+    bool IsEarlierOffer(const SlotOffer& lhs, const SlotOffer& rhs);
+    
+    // Reteaua de filiale. Programarile sunt directionate catre filiala aleasa, iar cautarea celui mai devreme
+    // interval se face in paralel pe filiale: fiecare sarcina din pool cauta primele k intervale intr-o filiala
+    // (fiecare filiala este citita de o singura sarcina), iar listele sortate sunt apoi interclasate intr-un top-k
+    class SalonNetwork {
+    private:
+        std::vector<std::unique_ptr<Branch>> m_branches;
+        TaskPool* m_task_pool;                              // nullptr = pool-ul comun
+        
+    public:
+        SalonNetwork();
+        SalonNetwork(const SalonNetwork&) = delete;
+        SalonNetwork& operator=(const SalonNetwork&) = delete;
+        
+        // Adauga o filiala noua; ID-urile filialelor sunt pozitiile lor in retea
+        Branch& AddBranch(const std::string& name, const GeoPoint& location);
+        
+        size_t GetBranchCount() const;
+        Branch* FindBranch(int branchId);
+        const Branch* FindBranch(int branchId) const;
+        const std::vector<std::unique_ptr<Branch>>& GetBranches() const;
+        
+        // Filialele aflate la cel mult radiusKm de punctul dat
+        std::vector<const Branch*> FindBranchesWithin(const GeoPoint& origin, double radiusKm) const;
+        
+        // Pool-ul folosit la cautare (nullptr = TaskPool::GetDefault())
+        TaskPool* GetTaskPool() const;
+        void SetTaskPool(TaskPool* pool);
+        
+        // Programeaza la filiala data; serviciul este cautat dupa nume in catalogul filialei,
+        // iar angajatul este ales automat de programul filialei
+        bool Book(int branchId, const Client& client, const std::string& serviceName, const TimeSlot& slot);
+        
+        // Programeaza intervalul dintr-o oferta
+        bool Book(const SlotOffer& offer, const Client& client);
+        
+        // Cele mai devreme maxCount intervale pentru serviciu, in filialele aflate la cel mult radiusKm,
+        // in zilele [firstDay, firstDay + dayCount); ordonate dupa IsEarlierOffer
+        std::vector<SlotOffer> FindEarliestSlots(const std::string& serviceName, const GeoPoint& origin, double radiusKm,
+                                                 int firstDay, int dayCount, size_t maxCount) const;
+    };
+}
+
+#endif // SALON_NETWORK_H
@@ -0,0 +1,102 @@
+#ifndef SALON_SERVER_H
+#define SALON_SERVER_H
+
+#include "command_processor.h"
+#include "format.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+
+namespace Beauty_Salon {
+    // Contoarele serverului
+    struct SalonServerStats {
+        std::uint64_t accepted;         // Conexiuni acceptate
+        std::uint64_t closed;           // Conexiuni inchise
+        std::uint64_t commands;         // Linii de comanda primite
+        std::uint64_t bytesIn;
+        std::uint64_t bytesOut;
+        std::uint64_t wakeups;          // Apeluri epoll_wait care au intors evenimente
+        std::size_t maxConnections;     // Numarul maxim de conexiuni deschise simultan
+        
+        SalonServerStats();
+    };
+    
+    // Server TCP cu o singura bucla epoll, pentru chioscuri si backend-ul site-ului (pe loopback).
+    // Protocolul este cel al CommandProcessor: o comanda pe linie, un raspuns pe linie (plus liniile rapoartelor).
+    // Toate conexiunile sunt servite din firul care apeleaza Run, deci programul nu are nevoie de sincronizare;
+    // comenzile unei conexiuni sunt executate in ordine, iar raspunsurile sunt trimise dupa fiecare citire.
+    // Formatul (format text|json) si referintele @n sunt tinute separat pentru fiecare conexiune; quit inchide doar conexiunea
+    class SalonServer {
+    private:
+        struct Connection {
+            int fd;
+            std::string input;              // Linia incompleta primita pana acum
+            std::string output;             // Raspunsuri netrimise inca (socket-ul era plin)
+            std::size_t outputOffset;
+            ReportFormat format;
+            std::vector<int> bookingIds;    // Referintele @n ale conexiunii (comenzile book trimise pe ea)
+            std::uint64_t acceptedWakeup;   // Trezirea in care a fost acceptata
+            bool readPaused;                // Nu mai citim pana se goleste output (clientul nu citeste raspunsurile)
+            bool closing;                   // Se inchide dupa trimiterea raspunsurilor
+            std::uint32_t events;           // Evenimentele inregistrate in epoll
+            
+            Connection(int socket, ReportFormat connectionFormat, std::uint64_t wakeup);
+        };
+        
+        CommandProcessor& m_processor;
+        ReportFormat m_default_format;          // Formatul conexiunilor noi (cel al procesorului la creare)
+        int m_listen_fd;
+        int m_epoll_fd;
+        int m_wake_fd;                          // eventfd folosit de Stop
+        std::uint16_t m_port;
+        std::vector<std::unique_ptr<Connection>> m_connections;    // Indexate dupa descriptor
+        std::size_t m_open_connections;
+        std::vector<char> m_read_buffer;        // Comun tuturor conexiunilor
+        TextBuffer m_responses;                 // Raspunsurile citirii curente
+        SalonServerStats m_stats;
+        
+        void _Accept();
+        void _Read(Connection& connection);
+        void _Write(Connection& connection);
+        void _Close(Connection& connection);
+        
+        // Executa liniile complete din data; intoarce false daca s-a primit quit sau linia e prea lunga
+        bool _ExecuteLines(Connection& connection, const char* data, std::size_t size);
+        
+        // Trimite raspunsurile acumulate; ce nu incape in socket ramane in connection.output
+        void _Flush(Connection& connection);
+        void _UpdateEvents(Connection& connection);
+        
+    public:
+        // Lungimea maxima a unei linii de comanda
+        static constexpr std::size_t MAX_LINE_BYTES = 4096;
+        // Peste atatea bytes netrimisi nu mai citim comenzi de la conexiune
+        static constexpr std::size_t MAX_PENDING_OUTPUT = 1024 * 1024;
+        
+        explicit SalonServer(CommandProcessor& processor);
+        SalonServer(const SalonServer&) = delete;
+        SalonServer& operator=(const SalonServer&) = delete;
+        ~SalonServer();
+        
+        // Deschide socket-ul de ascultare; port 0 alege un port liber (vezi GetPort)
+        bool Listen(const std::string& address, std::uint16_t port, int backlog = 4096);
+        std::uint16_t GetPort() const;
+        
+        // Serveste conexiunile pana la Stop; intoarce false daca serverul nu asculta
+        bool Run();
+        
+        // Opreste bucla; poate fi apelata din orice fir (sau din handler-ul unui semnal)
+        void Stop();
+        
+        // Contoarele; citite din alt fir sunt doar orientative
+        const SalonServerStats& GetStats() const;
+    };
+}
+
+#endif // __linux__
+
+#endif // SALON_SERVER_H
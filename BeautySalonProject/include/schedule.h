@@ -2,19 +2,49 @@
 #define SCHEDULE_H
 
 #include "appointment.h"
+#include "overlap_kernel.h"
+#include "report.h"
+#include "utilization.h"
+#include "task_pool.h"
 #include <vector>
 #include <map>
 #include <memory>
 
 namespace Beauty_Salon {
+    class DiscountProgram;
+    class ServiceCatalog;
+    class ShiftRoster;
+    
     // Clasa pentru gestionarea programarilor si optimizarea programului salonului
     class Schedule {
     private:
         std::vector<Appointment> m_appointments;      
-        std::map<int, int> m_employee_load;           
         int m_working_start_hour;                     
         int m_working_end_hour;                       
         int m_max_concurrent_apps;                    
+        mutable PackedIntervals m_intervals;          // Intervalele programarilor, paralel cu m_appointments
+        mutable UtilizationTracker m_utilization;     // Minutele rezervate per angajat, pe zile si ore
+        mutable bool m_intervals_dirty;               // Programarile au putut fi modificate prin FindAppointment
+        const ServiceCatalog* m_catalog;              // Catalogul folosit pentru alegerea angajatilor calificati
+        IConsumptionSink* m_consumption_sink;         // Atasat programarilor adaugate care nu au deja unul
+        const ShiftRoster* m_roster;                  // Turele angajatilor (nullptr = toti sunt prezenti toata ziua)
+        TaskPool* m_task_pool;                        // Pool-ul interogarilor mari (nullptr = pool-ul comun)
+        const DiscountProgram* m_discounts;           // Reducerile aplicate la incasare (nullptr = discount-ul clientului)
+        
+        // Reconstruieste intervalele impachetate si contoarele de ocupare daca programarile au fost modificate din exterior
+        void _SyncIntervals() const;
+        
+        // Programarile anulate nu ocupa timpul angajatului
+        static bool _CountsTowardUtilization(const Appointment& appointment);
+        
+        // Pozitia programarii cu ID-ul dat in m_appointments, sau m_appointments.size() daca nu exista
+        size_t _IndexOf(int id) const;
+        
+        // Pune programarea inapoi pe pozitia data, fara verificari (refacerea unei programari scoase temporar)
+        void _RestoreAt(size_t index, const Appointment& appointment);
+        
+        // Verifica daca angajatul are deja o programare care se suprapune cu intervalul
+        bool _HasEmployeeConflict(const TimeSlot& slot, const Employee* employee) const;
         
         // Verifica daca un interval de timp este disponibil pentru programare
         bool _IsTimeSlotAvailable(const TimeSlot& slot, Employee* employee) const;
@@ -22,12 +52,22 @@ namespace Beauty_Salon {
         // Verifica daca un interval de timp este in programul de lucru al salonului
         bool _IsWithinWorkingHours(const TimeSlot& slot) const;
         
+        // Verifica daca angajatul este in tura pe tot intervalul
+        bool _IsOnShift(const Employee* employee, const TimeSlot& slot) const;
+        
         // Gaseste un angajat disponibil pentru un anumit tip de serviciu si interval de timp
         Employee* _FindAvailableEmployee(ServiceType type, const TimeSlot& slot) const;
         
         // Obtine toate intervalele de timp disponibile pentru un serviciu intr-o anumita zi
         std::vector<TimeSlot> _GetAvailableTimeSlots(int date, Service* service) const;
         
+        // Pastreaza (in ordine) doar intervalele candidate care pot fi programate pentru serviciu;
+        // cu multe programari, intervalele sunt verificate in paralel pe pool
+        void _FilterAvailableSlots(const Service* service, std::vector<TimeSlot>& slots) const;
+        
+        // Pool-ul folosit de interogari
+        TaskPool& _GetTaskPool() const;
+        
     public:
         // Constructori
         Schedule();
@@ -37,11 +77,44 @@ namespace Beauty_Salon {
         int GetWorkingStartHour() const;
         int GetWorkingEndHour() const;
         int GetMaxConcurrentAppointments() const;
+        const ServiceCatalog* GetServiceCatalog() const;
+        IConsumptionSink* GetConsumptionSink() const;
+        const ShiftRoster* GetShiftRoster() const;
+        TaskPool* GetTaskPool() const;
+        const DiscountProgram* GetDiscountProgram() const;
         
         // Setteri
         void SetWorkingHours(int startHour, int endHour);
         void SetMaxConcurrentAppointments(int max);
         
+        // Seteaza catalogul din care se iau angajatii calificati la programarea fara angajat specificat
+        void SetServiceCatalog(const ServiceCatalog* catalog);
+        
+        // Seteaza destinatia consumului de produse pentru programarile adaugate de acum inainte
+        void SetConsumptionSink(IConsumptionSink* sink);
+        
+        // Seteaza turele angajatilor; programarile, sugestiile si alegerea angajatului tin cont de ele
+        void SetShiftRoster(const ShiftRoster* roster);
+        
+        // Seteaza pool-ul pe care ruleaza interogarile si rapoartele mari (nullptr = TaskPool::GetDefault())
+        void SetTaskPool(TaskPool* pool);
+        
+        // Seteaza reducerile cu care se incaseaza programarile finalizate si se recalculeaza preturile zilei
+        // (nullptr = discount-ul fiecarui client)
+        void SetDiscountProgram(const DiscountProgram* discounts);
+        
+        // Verifica daca angajatul este in tura si nu are alta programare in interval
+        bool IsEmployeeAvailable(const Employee* employee, const TimeSlot& slot) const;
+        
+        // Contoarele de ocupare ale angajatilor (minute rezervate pe zile si ore, in O(1))
+        const UtilizationTracker& GetUtilization() const;
+        
+        // Gradul de ocupare al angajatului pe zilele [firstDay, firstDay + dayCount)
+        double GetEmployeeBusyRatio(const Employee& employee, int firstDay, int dayCount) const;
+        
+        // Muta fereastra urmarita de contoarele de ocupare (recalculate din programari)
+        void SetUtilizationWindow(int firstDay);
+        
         // Adauga o programare in sistem
         bool AddAppointment(const Appointment& appointment);
         
@@ -51,15 +124,34 @@ namespace Beauty_Salon {
         // Adauga o programare in sistem cu un angajat specific
         bool AddAppointment(const Client& client, Employee* employee, Service* service, const TimeSlot& timeSlot);
         
+        // Adauga programari deja validate (de exemplu restaurate dintr-un fisier) fara verificarile de disponibilitate;
+        // intervalele si contoarele de ocupare sunt reconstruite o singura data, la urmatoarea interogare
+        void LoadAppointments(std::vector<Appointment> appointments);
+        
         // Elimina o programare din sistem
         bool RemoveAppointment(int id);
         
         // Actualizeaza datele unei programari existente
         bool UpdateAppointment(int id, const Appointment& newData);
         
+        // Muta programarea in alt interval (acelasi client, angajat si serviciu), ca Appointment::Reschedule: doar
+        // programarile active sau anulate (care redevin active). Daca programarea nu poate fi mutata sau noul interval
+        // nu poate fi programat, programarea ramane neschimbata (pe aceeasi pozitie) si se intoarce false
+        bool RescheduleAppointment(int id, const TimeSlot& newSlot);
+        
+        // Schimba starea programarii (Appointment::Cancel / Complete) fara a marca intervalele pentru reconstruire
+        bool CancelAppointment(int id);
+        bool CompleteAppointment(int id);
+        
+        // Marcheaza clientul ca neprezentat; intervalul ramane ocupat (angajatul l-a asteptat)
+        bool MarkNoShow(int id);
+        
         // Gaseste o programare dupa ID
         Appointment* FindAppointment(int id);
         
+        // Toate programarile, in ordinea adaugarii
+        const std::vector<Appointment>& GetAppointments() const;
+        
         // Metode de interogare
         std::vector<Appointment> GetAppointmentsByDate(int date) const;
         std::vector<Appointment> GetAppointmentsByClient(const Client& client) const;
@@ -68,14 +160,33 @@ namespace Beauty_Salon {
         // Algoritm de optimizare a programului - sugereaza intervale optime pentru o programare
         std::vector<TimeSlot> SuggestTimeSlots(const Client& client, Service* service, int preferredDate = 0) const;
         
+        // Primele maxCount intervale libere (pas de 15 minute) pentru serviciu in zilele [firstDay, firstDay + dayCount), in ordine cronologica
+        std::vector<TimeSlot> FindEarliestSlots(const Service* service, int firstDay, int dayCount, size_t maxCount) const;
+        
         // Rapoarte si statistici
         void GenerateDailyReport(int date) const;
         void GenerateEmployeeReport(const Employee& employee) const;
+        
+        // Calculeaza rapoartele ca structuri, pentru a fi scrise cu ReportWriter (text, JSON sau CSV)
+        DailyReport BuildDailyReport(int date) const;
+        EmployeeReport BuildEmployeeReport(const Employee& employee) const;
+        ScheduleReport BuildScheduleReport(int date) const;
+        
+        // Calculeaza rapoartele pentru mai multi angajati intr-o singura trecere prin programari
+        std::vector<EmployeeReport> BuildEmployeeReports(const std::vector<const Employee*>& employees) const;
         double CalculateDailyRevenue(int date) const;
         
+        // Recalculeaza in lot pretul tuturor programarilor dintr-o zi, citind inregistrarile de pret precompilate
+        // (cu programul de reduceri, daca este setat)
+        double QuoteDailyPrices(int date) const;
+        
         // Afisare informatii
         void DisplayDailySchedule(int date) const;
         void DisplayAllAppointments() const;
+        
+        // Randeaza programul zilei / toate programarile in buffer, pentru afisarea cu un singur apel de write
+        void RenderDailySchedule(TextBuffer& out, int date) const;
+        void RenderAllAppointments(TextBuffer& out) const;
     };
 }
 
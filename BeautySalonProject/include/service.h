@@ -3,9 +3,14 @@
 
 #include "interfaces.h"
 #include "utils.h"
+#include "format.h"
+#include "report.h"
+#include "pricing.h"
+#include "small_vector.h"
 #include <string>
 #include <iostream>
 #include <vector>
+#include <memory>
 
 namespace Beauty_Salon {
     // Clasa de baza pentru toate serviciile oferite de salon
@@ -15,11 +20,22 @@ namespace Beauty_Salon {
         double m_base_price;           
         ServiceDetails m_details;      
         ServiceType m_type;            
+        PriceRecord m_price_record;    // Regulile de pret compilate, valabile pana la urmatorul setter
+        std::uint32_t m_version;       // Creste la fiecare modificare a pretului sau duratei
+        
+        // Marcheaza modificarea pretului sau duratei (invalideaza totalurile memorate ale pachetelor)
+        void _Touch();
         
     protected:
         // Metoda protejata pentru actualizarea detaliilor serviciului în subclase
         void _UpdateDetails(const ServiceDetails& details);
         
+        // Seteaza tipul serviciului (apelata de subclase din constructori)
+        void _SetType(ServiceType type);
+        
+        // Recompileaza inregistrarea de pret (apelata de subclase din constructori si setteri)
+        void _CompilePriceRecord(double multiplier, double surcharge);
+        
     public:
         // Membri statici
         static int m_total_services_booked;  
@@ -35,11 +51,17 @@ namespace Beauty_Salon {
         virtual ~Service();
         
         // Getteri 
-        std::string GetName() const;
+        const std::string& GetName() const;
         double GetBasePrice() const;
         ServiceType GetType() const;
         const ServiceDetails& GetDetails() const;
         
+        // Inregistrarea de pret precompilata - citire fara apel virtual
+        const PriceRecord& GetPriceRecord() const { return m_price_record; }
+        
+        // Versiunea pretului si duratei, folosita pentru invalidarea totalurilor memorate
+        std::uint32_t GetVersion() const { return m_version; }
+        
         // Implementari ale metodelor din interfete
         virtual double ApplyDiscount(double amount) override;
         virtual int GetDuration() const override;
@@ -50,6 +72,9 @@ namespace Beauty_Salon {
         virtual int EstimateTime() = 0;       
         virtual void DisplayInfo() const;
         
+        // Scrie descrierea scurta a serviciului in buffer (acelasi format ca operatorul <<)
+        void FormatTo(TextBuffer& out) const;
+        
         // Supraincarcare operator pentru afisare
         friend std::ostream& operator<<(std::ostream& os, const Service& service);
     };
@@ -60,11 +85,16 @@ namespace Beauty_Salon {
         bool m_includes_washing;     
         bool m_includes_styling;    
         
+        // Compileaza regulile de pret pentru configuratia curenta
+        void _RecompilePrice();
+        
     public:
         // Constructori
         HairService();
         HairService(std::string name, double basePrice);
         HairService(std::string name, double basePrice, bool washing, bool styling);
+        // Tipul poate fi HAIR_CUT (implicit) sau HAIR_COLOR
+        HairService(std::string name, double basePrice, bool washing, bool styling, ServiceType type);
         
         // Setteri
         void SetIncludesWashing(bool includes);
@@ -86,11 +116,16 @@ namespace Beauty_Salon {
         bool m_is_gel;        
         int m_nail_count;     // Numărul de unghii (de obicei 10, dar poate fi mai puțin)
         
+        // Compileaza regulile de pret pentru configuratia curenta
+        void _RecompilePrice();
+        
     public:
         // Constructori
         NailService();
         NailService(std::string name, double basePrice);
         NailService(std::string name, double basePrice, bool isGel, int nailCount);
+        // Tipul poate fi MANICURE (implicit) sau PEDICURE
+        NailService(std::string name, double basePrice, bool isGel, int nailCount, ServiceType type);
         
         // Setteri
         void SetIsGel(bool isGel);
@@ -112,11 +147,16 @@ namespace Beauty_Salon {
         bool m_is_premium;              
         bool m_requires_special_room;   
         
+        // Compileaza regulile de pret pentru configuratia curenta
+        void _RecompilePrice();
+        
     public:
         // Constructori
         SpaService();
         SpaService(std::string name, double basePrice);
         SpaService(std::string name, double basePrice, bool isPremium, bool requiresSpecialRoom);
+        // Tipul poate fi MASSAGE (implicit) sau FACIAL
+        SpaService(std::string name, double basePrice, bool isPremium, bool requiresSpecialRoom, ServiceType type);
         
         // Setteri
         void SetIsPremium(bool isPremium);
@@ -135,29 +175,57 @@ namespace Beauty_Salon {
     // Pachet de servicii (pentru demonstrarea operatorului +)
     class ServicePackage {
     private:
+        // Numarul de servicii stocate fara alocare pe heap (pachetele obisnuite au 2-6 servicii)
+        static constexpr size_t INLINE_ITEMS = 6;
+        
         std::string m_name;                  
-        std::vector<Service*> m_services;    
+        SmallVector<const Service*, INLINE_ITEMS> m_services;       // Serviciile sunt detinute de catalog (adrese stabile)
+        SmallVector<const PriceRecord*, INLINE_ITEMS> m_records;    // Inregistrarile de pret ale serviciilor, in aceeasi ordine
         double m_package_discount;           
+        mutable MemoizedTotals<INLINE_ITEMS> m_totals;              // Pretul si durata totala, invalidate de versiunile serviciilor
+        
+        // Recalculeaza totalurile memorate daca vreun serviciu s-a modificat
+        void _RefreshTotals() const;
         
     public:
         // Constructori si destructor
         ServicePackage();
         ServicePackage(const std::string& name);
         ServicePackage(const std::string& name, double packageDiscount);
+        ServicePackage(const ServicePackage&) = default;
+        ServicePackage(ServicePackage&&) = default;
+        ServicePackage& operator=(const ServicePackage&) = default;
+        ServicePackage& operator=(ServicePackage&&) = default;
         ~ServicePackage();
         
         // Metode pentru gestionarea pachetului
-        void AddService(Service* service);
+        void AddService(const Service* service);
+        size_t GetServiceCount() const;
+        const Service* GetService(size_t index) const;
+        const std::string& GetName() const;
+        double GetPackageDiscount() const;
+        
+        // Adauga un serviciu in pachet (folosit de operatorul + la inlantuire)
+        ServicePackage& operator+=(const Service& service);
+        
         double CalculateTotalPrice() const;
         int CalculateTotalTime() const;
         void DisplayPackageInfo() const;
         
+        // Calculeaza descrierea pachetului ca structura, pentru a fi scrisa cu ReportWriter
+        PackageReport BuildReport() const;
+        
         // Supraincarcare operator pentru afisare
         friend std::ostream& operator<<(std::ostream& os, const ServicePackage& package);
     };
 
-    // Operator pentru combinarea serviciilor intr-un pachet
+    // Scrie lista numerotata a serviciilor in buffer, pentru afisarea cu un singur apel de write
+    void RenderServiceList(TextBuffer& out, const std::vector<std::unique_ptr<Service>>& services);
+
+    // Operatori pentru combinarea serviciilor intr-un pachet; a + b + c adauga in acelasi pachet temporar
     ServicePackage operator+(const Service& lhs, const Service& rhs);
+    ServicePackage operator+(ServicePackage&& package, const Service& service);
+    ServicePackage operator+(const ServicePackage& package, const Service& service);
 }
 
 #endif // SERVICE_H
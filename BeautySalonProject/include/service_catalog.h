@@ -0,0 +1,68 @@
+#ifndef SERVICE_CATALOG_H
+#define SERVICE_CATALOG_H
+
+#include "service.h"
+#include "employee.h"
+#include "qualification_matrix.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Catalogul serviciilor salonului, cu indexuri dupa nume, tip si camera
+    // si cu listele precalculate de angajati calificati pentru fiecare serviciu
+    class ServiceCatalog {
+    private:
+        std::vector<std::unique_ptr<Service>> m_services;                     
+        std::unordered_map<std::string, Service*> m_by_name;                  
+        std::unordered_map<const Service*, size_t> m_index_of;                // Pozitia fiecarui serviciu in m_services
+        std::vector<Service*> m_by_type[SERVICE_TYPE_COUNT];                  
+        std::unordered_map<std::string, std::vector<Service*>> m_by_room;     
+        std::vector<std::vector<Employee*>> m_qualified;                      // Angajatii calificati, per serviciu
+        std::vector<Employee*> m_qualified_by_type[SERVICE_TYPE_COUNT];       // Angajatii calificati, per tip de serviciu
+        std::vector<Employee*> m_employees;                                   // Angajatii folositi la ultima calculare
+        QualificationMatrix m_matrix;                                         // Calificarile angajatilor ca bitset-uri per tip
+        
+        // Adauga serviciul in indexurile dupa tip si camera
+        void _IndexService(Service* service);
+        
+        // Calculeaza lista de angajati calificati pentru serviciul de pe pozitia index
+        void _BuildQualification(size_t index);
+        
+    public:
+        ServiceCatalog();
+        ServiceCatalog(const ServiceCatalog&) = delete;
+        ServiceCatalog& operator=(const ServiceCatalog&) = delete;
+        
+        // Adauga un serviciu in catalog; intoarce nullptr daca exista deja un serviciu cu acelasi nume
+        Service* AddService(std::unique_ptr<Service> service);
+        
+        // Getteri
+        size_t GetServiceCount() const;
+        Service* GetService(size_t index) const;
+        const std::vector<std::unique_ptr<Service>>& GetServices() const;
+        
+        // Cautari in O(1)
+        Service* FindByName(const std::string& name) const;
+        const std::vector<Service*>& FindByType(ServiceType type) const;
+        const std::vector<Service*>& FindByRoom(const std::string& room) const;
+        
+        // Precalculeaza angajatii calificati (Employee::CanProvide) pentru fiecare serviciu si tip de serviciu
+        void BuildQualifications(const std::vector<std::unique_ptr<Employee>>& employees);
+        void BuildQualifications(const std::vector<Employee*>& employees);
+        
+        // Angajatii calificati pentru un serviciu sau un tip de serviciu (lista precalculata)
+        const std::vector<Employee*>& GetQualifiedEmployees(const Service* service) const;
+        const std::vector<Employee*>& GetQualifiedEmployees(ServiceType type) const;
+        
+        // Angajatii care pot face toate tipurile de servicii din masca (un AND intre bitset-uri)
+        std::vector<Employee*> GetQualifiedEmployees(ServiceTypeMask types) const;
+        const QualificationMatrix& GetQualificationMatrix() const;
+        
+        // Reconstruieste indexurile dupa camera si tip (daca serviciile au fost modificate dupa adaugare)
+        void Reindex();
+    };
+}
+
+#endif // SERVICE_CATALOG_H
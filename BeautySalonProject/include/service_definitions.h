@@ -0,0 +1,158 @@
+#ifndef SERVICE_DEFINITIONS_H
+#define SERVICE_DEFINITIONS_H
+
+#include "service.h"
+#include <cstddef>
+
+namespace Beauty_Salon {
+    // Regulile de pret si durata ale serviciilor, evaluabile la compilare.
+    // Sunt folosite atat de HairService/NailService/SpaService cat si de definitiile constexpr de mai jos.
+    namespace ServiceRules {
+        constexpr double HairSurcharge(bool washing, bool styling) {
+            return (washing ? 10.0 : 0.0) + (styling ? 15.0 : 0.0);
+        }
+        
+        constexpr int HairDuration(bool washing, bool styling) {
+            return 30 + (washing ? 15 : 0) + (styling ? 20 : 0);
+        }
+        
+        constexpr double NailMultiplier(bool isGel, int nailCount) {
+            // Gel-ul costa mai mult; pretul scade pentru mai putin de 10 unghii
+            return (isGel ? 1.5 : 1.0) * (nailCount < 10 ? nailCount / 10.0 : 1.0);
+        }
+        
+        constexpr int NailDuration(bool isGel, int nailCount) {
+            return nailCount < 10 ? static_cast<int>((isGel ? 60 : 45) * (nailCount / 10.0)) : (isGel ? 60 : 45);
+        }
+        
+        constexpr double SpaMultiplier(bool isPremium) {
+            return isPremium ? 1.75 : 1.0;
+        }
+        
+        constexpr double SpaSurcharge(bool requiresSpecialRoom) {
+            return requiresSpecialRoom ? 30.0 : 0.0;
+        }
+        
+        constexpr int SpaDuration(bool isPremium) {
+            return isPremium ? 90 : 60;
+        }
+    }
+    
+    // Definitia unui serviciu din meniul fix al salonului, calculata complet la compilare
+    struct ServiceDefinition {
+        const char* name;           
+        ServiceType type;           
+        double basePrice;           
+        double multiplier;          
+        double surcharge;           
+        int duration;               
+        const char* room;           
+        bool needsPreparation;      
+        
+        // Pretul final (basePrice * multiplier + surcharge), la fel ca PriceRecord
+        constexpr double Price() const {
+            return basePrice * multiplier + surcharge;
+        }
+    };
+    
+    // Functii constexpr pentru construirea definitiilor cu aceleasi reguli ca subclasele Service
+    constexpr ServiceDefinition MakeHairDefinition(const char* name, double basePrice, bool washing, bool styling,
+                                                   ServiceType type = ServiceType::HAIR_CUT) {
+        return ServiceDefinition{name, type, basePrice, 1.0, ServiceRules::HairSurcharge(washing, styling),
+                                 ServiceRules::HairDuration(washing, styling), "Hair Station", false};
+    }
+    
+    constexpr ServiceDefinition MakeNailDefinition(const char* name, double basePrice, bool isGel, int nailCount,
+                                                   ServiceType type = ServiceType::MANICURE) {
+        return ServiceDefinition{name, type, basePrice, ServiceRules::NailMultiplier(isGel, nailCount), 0.0,
+                                 ServiceRules::NailDuration(isGel, nailCount), "Nail Station", false};
+    }
+    
+    constexpr ServiceDefinition MakeSpaDefinition(const char* name, double basePrice, bool isPremium, bool requiresSpecialRoom,
+                                                  ServiceType type = ServiceType::MASSAGE) {
+        return ServiceDefinition{name, type, basePrice, ServiceRules::SpaMultiplier(isPremium),
+                                 ServiceRules::SpaSurcharge(requiresSpecialRoom), ServiceRules::SpaDuration(isPremium),
+                                 requiresSpecialRoom ? "Premium Spa Room" : "Spa Room", true};
+    }
+    
+    // Meniul salonului
+    constexpr ServiceDefinition SALON_MENU[] = {
+        MakeHairDefinition("Tuns", 30.0, true, true, ServiceType::HAIR_CUT),
+        MakeHairDefinition("Vopsit", 80.0, true, false, ServiceType::HAIR_COLOR),
+        MakeNailDefinition("Manichiura", 25.0, false, 10, ServiceType::MANICURE),
+        MakeNailDefinition("Pedichiura", 35.0, true, 10, ServiceType::PEDICURE),
+        MakeSpaDefinition("Masaj Relaxare", 50.0, false, false, ServiceType::MASSAGE),
+        MakeSpaDefinition("Tratament Facial Premium", 75.0, true, true, ServiceType::FACIAL)
+    };
+    
+    constexpr std::size_t SALON_MENU_SIZE = sizeof(SALON_MENU) / sizeof(SALON_MENU[0]);
+    
+    // Compara doua siruri de caractere la compilare
+    constexpr bool EqualNames(const char* lhs, const char* rhs) {
+        return *lhs == *rhs && (*lhs == '\0' || EqualNames(lhs + 1, rhs + 1));
+    }
+    
+    // Cauta la compilare pozitia unui serviciu in meniu dupa nume (SALON_MENU_SIZE daca nu exista)
+    constexpr std::size_t FindMenuIndex(const char* name, std::size_t index = 0) {
+        return index == SALON_MENU_SIZE ? SALON_MENU_SIZE
+             : EqualNames(SALON_MENU[index].name, name) ? index
+             : FindMenuIndex(name, index + 1);
+    }
+    
+    // Intrarea de pe pozitia Index din meniu, cu pretul si durata ca si constante de compilare
+    template <std::size_t Index>
+    struct MenuEntry {
+        static_assert(Index < SALON_MENU_SIZE, "Serviciul nu exista in meniul salonului");
+        
+        static constexpr const ServiceDefinition& DEFINITION = SALON_MENU[Index];
+        static constexpr double PRICE = SALON_MENU[Index].Price();
+        static constexpr int DURATION = SALON_MENU[Index].duration;
+    };
+    
+    // Serviciu generat dintr-o definitie constexpr. Pretul si durata sunt constante,
+    // iar metodele finale permit compilatorului sa elimine apelul virtual cand tipul este cunoscut.
+    template <typename Definition>
+    class DefinedService final : public Service {
+    public:
+        DefinedService() 
+            : Service(Definition::DEFINITION.name, Definition::DEFINITION.basePrice,
+                      ServiceDetails(Definition::DURATION, Definition::DEFINITION.room, Definition::DEFINITION.needsPreparation)) {
+            _SetType(Definition::DEFINITION.type);
+            _CompilePriceRecord(Definition::DEFINITION.multiplier, Definition::DEFINITION.surcharge);
+        }
+        
+        // Pretul si durata la compilare
+        static constexpr double GetStaticPrice() { return Definition::PRICE; }
+        static constexpr int GetStaticDuration() { return Definition::DURATION; }
+        
+        // Implementari ale metodelor virtuale
+        virtual double CalculatePrice() override { return Definition::PRICE; }
+        virtual int EstimateTime() override { return Definition::DURATION; }
+    };
+    
+    // Serviciul de pe pozitia Index din meniul salonului
+    template <std::size_t Index>
+    using MenuService = DefinedService<MenuEntry<Index>>;
+    
+    // Pretul unui pachet de servicii din meniu, cu discount-ul pachetului (procent), calculat la compilare
+    template <std::size_t... Indices>
+    constexpr double MenuPackagePrice(double packageDiscount) {
+        double total = 0.0;
+        for (double price : {MenuEntry<Indices>::PRICE...}) {
+            total += price;
+        }
+        return total * (1.0 - packageDiscount / 100.0);
+    }
+    
+    // Durata unui pachet de servicii din meniu, calculata la compilare
+    template <std::size_t... Indices>
+    constexpr int MenuPackageDuration() {
+        int total = 0;
+        for (int duration : {MenuEntry<Indices>::DURATION...}) {
+            total += duration;
+        }
+        return total;
+    }
+}
+
+#endif // SERVICE_DEFINITIONS_H
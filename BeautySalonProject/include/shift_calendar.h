@@ -0,0 +1,125 @@
+#ifndef SHIFT_CALENDAR_H
+#define SHIFT_CALENDAR_H
+
+#include "employee.h"
+#include "utils.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Numarul de zile din tiparul saptamanal (ziua d din TimeSlot cade in ziua saptamanii d % 7)
+    constexpr int DAYS_PER_WEEK = 7;
+    
+    // Motivul unei absente
+    enum class TimeOffReason {
+        VACATION,       
+        SICK_LEAVE,     
+        OTHER           
+    };
+    
+    // Un interval de minute [startMinute, endMinute) dintr-o zi
+    struct MinuteRange {
+        int startMinute;    
+        int endMinute;      
+    };
+    
+    // O absenta: zilele [firstDay, lastDay], in intervalul de minute dat din fiecare zi (toata ziua implicit)
+    struct TimeOff {
+        int firstDay;           
+        int lastDay;            
+        MinuteRange minutes;    
+        TimeOffReason reason;   
+    };
+    
+    // Disponibilitatea unei zile, cate un bit pentru fiecare minut
+    class DayAvailability {
+    public:
+        static constexpr size_t WORD_COUNT = (TimeSlot::MINUTES_PER_DAY + 63) / 64;
+        
+    private:
+        std::uint64_t m_words[WORD_COUNT];
+        
+    public:
+        DayAvailability();
+        
+        void Clear();
+        void SetRange(int startMinute, int endMinute);
+        void ClearRange(int startMinute, int endMinute);
+        
+        // Toate minutele din [startMinute, endMinute) sunt disponibile (cateva operatii pe cuvinte)
+        bool IsRangeSet(int startMinute, int endMinute) const;
+        
+        int CountMinutes() const;
+        bool IsEmpty() const;
+        const std::uint64_t* GetWords() const { return m_words; }
+    };
+    
+    // Programul de lucru al unui angajat: ture saptamanale, pauze si absente, compilate la fiecare modificare
+    // in masti de minute per zi a saptamanii si per zi cu exceptii
+    class ShiftCalendar {
+    private:
+        std::vector<MinuteRange> m_shifts[DAYS_PER_WEEK];               
+        std::vector<MinuteRange> m_breaks[DAYS_PER_WEEK];               
+        std::vector<TimeOff> m_time_off;                                
+        DayAvailability m_weekly[DAYS_PER_WEEK];                        // Masca compilata pentru fiecare zi a saptamanii
+        std::unordered_map<int, DayAvailability> m_exceptions;          // Masca compilata pentru zilele cu absente partiale
+        std::vector<std::pair<int, int>> m_days_off;                    // Absentele de zile intregi [prima, ultima zi]
+        DayAvailability m_day_off;                                      // Masca goala, intoarsa pentru zilele de absenta
+        
+        // Recompileaza toate mastile din ture, pauze si absente (absentele de zile intregi raman intervale,
+        // ca o absenta lunga sa nu creeze cate o masca pentru fiecare zi)
+        void _Compile();
+        
+    public:
+        ShiftCalendar();
+        
+        // Adauga o tura, respectiv o pauza, in ziua saptamanii data (0-6)
+        bool AddShift(int weekday, int startMinute, int endMinute);
+        bool AddBreak(int weekday, int startMinute, int endMinute);
+        
+        // Adauga aceeasi tura in mai multe zile ale saptamanii (bitul i din weekdays = ziua i)
+        void AddWeeklyShift(unsigned weekdays, int startMinute, int endMinute);
+        
+        // Adauga o absenta pentru zile intregi sau pentru un interval dintr-o zi
+        bool AddTimeOff(int firstDay, int lastDay, TimeOffReason reason);
+        bool AddTimeOff(int day, int startMinute, int endMinute, TimeOffReason reason);
+        
+        // Sterge turele, pauzele si absentele
+        void Clear();
+        
+        // Masca zilei (fara calcule de calendar: o trecere prin absentele de zile intregi, o cautare in exceptii
+        // si un indice in tiparul saptamanal)
+        const DayAvailability& GetDay(int day) const;
+        
+        // Angajatul este in tura pe tot intervalul
+        bool IsAvailable(const TimeSlot& slot) const;
+        
+        const std::vector<TimeOff>& GetTimeOff() const;
+    };
+    
+    // Calendarele tuturor angajatilor, indexate dupa ID-ul angajatului
+    class ShiftRoster {
+    private:
+        std::vector<std::unique_ptr<ShiftCalendar>> m_calendars;     // Pe pozitia ID-ului angajatului
+        
+    public:
+        ShiftRoster();
+        ShiftRoster(const ShiftRoster&) = delete;
+        ShiftRoster& operator=(const ShiftRoster&) = delete;
+        
+        // Calendarul angajatului (creat gol la primul apel)
+        ShiftCalendar& GetCalendar(const Employee& employee);
+        
+        // Calendarul angajatului sau nullptr daca nu are unul
+        const ShiftCalendar* FindCalendar(int employeeId) const;
+        
+        // Angajatii fara calendar sunt considerati disponibili oricand
+        bool IsAvailable(const Employee* employee, const TimeSlot& slot) const;
+    };
+}
+
+#endif // SHIFT_CALENDAR_H
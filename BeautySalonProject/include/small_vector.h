@@ -0,0 +1,134 @@
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace Beauty_Salon {
+    // Vector cu primele N elemente stocate in obiect (fara alocare pe heap);
+    // trece pe heap doar cand depaseste N elemente. Pentru tipuri copiabile trivial (pointeri, handle-uri)
+    template <typename T, std::size_t N>
+    class SmallVector {
+        static_assert(std::is_trivially_copyable<T>::value, "SmallVector stocheaza doar tipuri copiabile trivial");
+        static_assert(N > 0, "SmallVector are nevoie de cel putin un element inline");
+        
+    private:
+        T m_inline[N];              
+        T* m_data;                  // m_inline sau memoria alocata pe heap
+        std::size_t m_size;         
+        std::size_t m_capacity;     
+        
+        bool _IsInline() const { return m_data == m_inline; }
+        
+        void _Grow(std::size_t capacity) {
+            T* data = new T[capacity];
+            if (m_size > 0) {
+                std::memcpy(data, m_data, m_size * sizeof(T));
+            }
+            if (!_IsInline()) {
+                delete[] m_data;
+            }
+            m_data = data;
+            m_capacity = capacity;
+        }
+        
+        void _CopyFrom(const SmallVector& other) {
+            if (other.m_size > m_capacity) {
+                _Grow(other.m_size);
+            }
+            if (other.m_size > 0) {
+                std::memcpy(m_data, other.m_data, other.m_size * sizeof(T));
+            }
+            m_size = other.m_size;
+        }
+        
+        // Preia memoria de pe heap a celuilalt vector sau copiaza elementele inline
+        void _MoveFrom(SmallVector& other) {
+            if (other._IsInline()) {
+                _CopyFrom(other);
+            } else {
+                if (!_IsInline()) {
+                    delete[] m_data;
+                }
+                m_data = other.m_data;
+                m_size = other.m_size;
+                m_capacity = other.m_capacity;
+                other.m_data = other.m_inline;
+                other.m_capacity = N;
+            }
+            other.m_size = 0;
+        }
+        
+    public:
+        SmallVector() : m_data(m_inline), m_size(0), m_capacity(N) {
+        }
+        
+        SmallVector(const SmallVector& other) : m_data(m_inline), m_size(0), m_capacity(N) {
+            _CopyFrom(other);
+        }
+        
+        SmallVector(SmallVector&& other) noexcept : m_data(m_inline), m_size(0), m_capacity(N) {
+            _MoveFrom(other);
+        }
+        
+        SmallVector& operator=(const SmallVector& other) {
+            if (this != &other) {
+                _CopyFrom(other);
+            }
+            return *this;
+        }
+        
+        SmallVector& operator=(SmallVector&& other) noexcept {
+            if (this != &other) {
+                _MoveFrom(other);
+            }
+            return *this;
+        }
+        
+        ~SmallVector() {
+            if (!_IsInline()) {
+                delete[] m_data;
+            }
+        }
+        
+        void PushBack(const T& value) {
+            if (m_size == m_capacity) {
+                // Copiem valoarea inainte de realocare (poate fi un element din acest vector)
+                T copy = value;
+                _Grow(m_capacity * 2);
+                m_data[m_size++] = copy;
+                return;
+            }
+            m_data[m_size++] = value;
+        }
+        
+        void Reserve(std::size_t capacity) {
+            if (capacity > m_capacity) {
+                _Grow(capacity);
+            }
+        }
+        
+        void Clear() { m_size = 0; }
+        
+        std::size_t Size() const { return m_size; }
+        std::size_t GetCapacity() const { return m_capacity; }
+        bool IsEmpty() const { return m_size == 0; }
+        
+        // Elementele sunt inca stocate in obiect (nu s-a alocat memorie pe heap)
+        bool IsInline() const { return _IsInline(); }
+        
+        T* Data() { return m_data; }
+        const T* Data() const { return m_data; }
+        
+        T& operator[](std::size_t index) { return m_data[index]; }
+        const T& operator[](std::size_t index) const { return m_data[index]; }
+        
+        T* begin() { return m_data; }
+        T* end() { return m_data + m_size; }
+        const T* begin() const { return m_data; }
+        const T* end() const { return m_data + m_size; }
+    };
+}
+
+#endif // SMALL_VECTOR_H
@@ -0,0 +1,170 @@
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Statisticile sarcinilor executate de un pool (cumulate de la crearea pool-ului sau de la ResetStats)
+    struct TaskPoolStats {
+        size_t threadCount;
+        std::uint64_t submitted;            // Sarcini trimise in pool
+        std::uint64_t executed;             // Sarcini executate (de fire sau de apelanti)
+        std::uint64_t stolen;               // Sarcini luate din coada altui fir
+        std::uint64_t runByCaller;          // Sarcini executate de firele care asteptau un TaskGroup
+        std::uint64_t totalTaskNanoseconds;
+        std::uint64_t maxTaskNanoseconds;
+        std::vector<std::uint64_t> executedPerThread;
+        
+        TaskPoolStats();
+        
+        // Durata medie a unei sarcini, in microsecunde
+        double GetAverageTaskMicroseconds() const;
+    };
+    
+    // Pool de fire cu furt de sarcini. Fiecare fir are propria coada: sarcinile trimise de un fir al pool-ului
+    // intra in coada lui si sunt luate de el in ordine LIFO, iar firele fara lucru fura din celelalte cozi in ordine FIFO.
+    // Firele care asteapta un TaskGroup executa si ele sarcini, deci fork-join-ul imbricat nu se blocheaza.
+    // Un pool cu 0 fire executa totul pe firul apelantului.
+    class TaskPool {
+    public:
+        using Task = std::function<void()>;
+        
+    private:
+        // Coada unui fir si contoarele lui (aliniat pentru a evita false sharing)
+        struct alignas(64) Worker {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+            std::atomic<std::uint64_t> executed{0};
+            std::atomic<std::uint64_t> stolen{0};
+            std::atomic<std::uint64_t> nanoseconds{0};
+            std::atomic<std::uint64_t> maxNanoseconds{0};
+        };
+        
+        std::vector<std::unique_ptr<Worker>> m_workers;
+        std::vector<std::thread> m_threads;
+        std::atomic<size_t> m_queued;                       // Sarcini aflate in cozi
+        std::atomic<size_t> m_next_queue;                   // Coada urmatoarei sarcini trimise din afara pool-ului
+        std::atomic<std::uint64_t> m_submitted;
+        Worker m_caller;                                    // Contoarele sarcinilor executate de apelanti (coada nefolosita)
+        Worker m_retired;                                   // Contoarele firelor oprite de Resize
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_wake;
+        bool m_stop;
+        
+        void _Start(size_t threads);
+        void _Stop();
+        void _WorkerLoop(size_t index);
+        
+        // Indexul firului curent in acest pool, sau -1 daca firul nu apartine pool-ului
+        int _CurrentWorker() const;
+        
+        // Scoate o sarcina: intai din coada proprie (LIFO), apoi din celelalte (FIFO)
+        bool _TryPop(int self, Task& task);
+        
+        // Executa sarcina si actualizeaza contoarele
+        void _Execute(Task& task, Worker& stats);
+        
+    public:
+        explicit TaskPool(size_t threads);
+        TaskPool(const TaskPool&) = delete;
+        TaskPool& operator=(const TaskPool&) = delete;
+        ~TaskPool();
+        
+        size_t GetThreadCount() const;
+        
+        // Schimba numarul de fire; sarcinile deja trimise sunt terminate inainte. Nu se apeleaza cat timp pool-ul e folosit
+        void Resize(size_t threads);
+        
+        // Trimite o sarcina fara asteptarea rezultatului (cu 0 fire, sarcina ruleaza imediat)
+        void Submit(Task task);
+        
+        // Executa o sarcina din cozi pe firul curent; intoarce false daca toate cozile sunt goale
+        bool RunPendingTask();
+        
+        TaskPoolStats GetStats() const;
+        void ResetStats();
+        
+        // Imparte [begin, end) in blocuri de grain elemente (ultimul poate fi mai mic) si apeleaza fn(blockBegin, blockEnd) in paralel.
+        // Blocurile sunt aceleasi indiferent de numarul de fire; apelantul executa si el blocuri pana la terminare
+        template <typename Fn>
+        void ParallelFor(size_t begin, size_t end, size_t grain, Fn&& fn);
+        
+        // Executa cele doua functii in paralel si asteapta terminarea amandurora
+        template <typename Left, typename Right>
+        void ForkJoin(Left&& left, Right&& right);
+        
+        // Pool-ul comun al bibliotecii (implicit: numarul de nuclee - 1 fire, apelantul fiind al N-lea)
+        static TaskPool& GetDefault();
+    };
+    
+    // Un grup de sarcini asteptate impreuna (fork-join). Wait executa sarcini din pool pana cand grupul se termina.
+    // Daca o sarcina arunca o exceptie, celelalte sarcini se termina normal, iar Wait arunca prima exceptie prinsa
+    class TaskGroup {
+    private:
+        TaskPool& m_pool;
+        std::atomic<size_t> m_pending;
+        std::mutex m_error_mutex;
+        std::exception_ptr m_error;                         // Prima exceptie aruncata de o sarcina (protejata de m_error_mutex)
+        
+        // Asteapta terminarea sarcinilor, fara a arunca exceptia lor
+        void _WaitPending();
+        
+    public:
+        explicit TaskGroup(TaskPool& pool);
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+        // Asteapta sarcinile ramase; o exceptie neridicata inca prin Wait este pierduta
+        ~TaskGroup();
+        
+        void Run(TaskPool::Task task);
+        void Wait();
+    };
+    
+    template <typename Fn>
+    void TaskPool::ParallelFor(size_t begin, size_t end, size_t grain, Fn&& fn) {
+        if (begin >= end) {
+            return;
+        }
+        grain = std::max<size_t>(1, grain);
+        if (m_workers.empty() || end - begin <= grain) {
+            fn(begin, end);
+            return;
+        }
+        
+        TaskGroup group(*this);
+        size_t first = std::min(end, begin + grain);
+        for (size_t blockBegin = first; blockBegin < end; blockBegin += grain) {
+            size_t blockEnd = std::min(end, blockBegin + grain);
+            group.Run([&fn, blockBegin, blockEnd]() { fn(blockBegin, blockEnd); });
+        }
+        fn(begin, first);
+        group.Wait();
+    }
+    
+    template <typename Left, typename Right>
+    void TaskPool::ForkJoin(Left&& left, Right&& right) {
+        if (m_workers.empty()) {
+            left();
+            right();
+            return;
+        }
+        
+        TaskGroup group(*this);
+        group.Run([&right]() { right(); });
+        left();
+        group.Wait();
+    }
+}
+
+#endif // TASK_POOL_H
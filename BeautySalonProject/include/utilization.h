@@ -0,0 +1,78 @@
+#ifndef UTILIZATION_H
+#define UTILIZATION_H
+
+#include "employee.h"
+#include "utils.h"
+#include <cstddef>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Minutele rezervate per angajat, pe zile si ore, intr-o fereastra glisanta de WINDOW_DAYS zile.
+    // O rezervare pentru o zi de dupa fereastra muta fereastra inainte (zilele iesite din fereastra sunt uitate);
+    // rezervarile pentru zile de dinaintea ferestrei nu sunt urmarite, dar minutele lor sunt numarate separat.
+    // Angajatii primesc un slot dens la prima rezervare; contoarele tuturor angajatilor stau in tablouri plate,
+    // iar sumele prefix pe zile permit interogari "minute rezervate / grad de ocupare pe N zile" in O(1)
+    class UtilizationTracker {
+    public:
+        static constexpr int WINDOW_DAYS = 64;      // Putere a lui 2 (indexul in inel este day & (WINDOW_DAYS - 1))
+        static constexpr int HOURS_PER_DAY = 24;
+        
+    private:
+        std::vector<int> m_slot_of_id;          // ID angajat -> slot dens (-1 = fara slot)
+        std::vector<int> m_day_minutes;         // [slot][zi in inel]
+        std::vector<int> m_prefix;              // [slot][0..WINDOW_DAYS], sume prefix in ordinea zilelor din fereastra
+        std::vector<int> m_hour_minutes;        // [slot][zi in inel][ora]
+        std::vector<int> m_bookings;            // Numarul de programari active, per slot
+        int m_slot_count;                       
+        int m_window_start;                     // Prima zi din fereastra
+        int m_daily_capacity;                   // Minutele de lucru disponibile intr-o zi
+        long long m_ignored_minutes;            // Minutele rezervate in zile de dinaintea ferestrei
+        
+        int _SlotOf(int employeeId) const;
+        int _EnsureSlot(int employeeId);
+        
+        // Adauga (sign = 1) sau scoate (sign = -1) minutele intervalului din contoarele slotului
+        void _Apply(int slot, const TimeSlot& timeSlot, int sign);
+        
+        // Adauga minute unei zile si actualizeaza sumele prefix de dupa ea
+        void _AddDayMinutes(int slot, int day, int hour, int minutes);
+        
+        // Muta fereastra inainte: goleste zilele iesite si reface sumele prefix in noua ordine
+        void _AdvanceWindow(int windowStart);
+        
+    public:
+        UtilizationTracker();
+        
+        // Minutele disponibile pe zi (numitorul gradului de ocupare)
+        int GetDailyCapacity() const;
+        void SetDailyCapacity(int minutes);
+        
+        // Fereastra urmarita: zilele [windowStart, windowStart + WINDOW_DAYS)
+        int GetWindowStart() const;
+        
+        // Muta fereastra si goleste contoarele (apelantul reinregistreaza rezervarile din noua fereastra)
+        void ResetWindow(int windowStart);
+        
+        // Inregistreaza / scoate o rezervare. O rezervare care se termina dupa fereastra o muta inainte;
+        // zilele de dinaintea ferestrei sunt ignorate
+        void AddBooking(const Employee* employee, const TimeSlot& timeSlot);
+        void RemoveBooking(const Employee* employee, const TimeSlot& timeSlot);
+        
+        // Goleste toate contoarele (sloturile raman alocate, fereastra ramane pe loc)
+        void Clear();
+        
+        // Minutele rezervarilor adaugate pentru zile de dinaintea ferestrei (neincluse in interogari)
+        long long GetIgnoredMinutes() const;
+        
+        // Interogari in O(1)
+        int GetActiveBookings(int employeeId) const;
+        int GetBookedMinutes(int employeeId, int firstDay, int dayCount) const;
+        int GetBookedMinutesInHour(int employeeId, int day, int hour) const;
+        double GetBusyRatio(int employeeId, int firstDay, int dayCount) const;
+        
+        // Numarul de angajati cu slot alocat
+        int GetSlotCount() const;
+    };
+}
+
+#endif // UTILIZATION_H
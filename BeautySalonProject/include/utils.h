@@ -3,24 +3,98 @@
 
 #include <string>
 #include <ctime>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
 
 namespace Beauty_Salon {
-    // Structura pentru intervale de timp utilizate in programari
+    // Interval de timp utilizat in programari, codificat intr-un singur cuvant de 64 de biti:
+    // [63..32] ziua, [31..16] minutul de start din zi, [15..0] durata in minute.
+    // Valorile sunt aduse in domeniu la construire: un minut de start din afara [0, MINUTES_PER_DAY) muta intervalul
+    // in ziua corespunzatoare (acelasi moment absolut), iar durata este limitata la [0, MAX_DURATION].
     struct TimeSlot {
-        int hour;        // Ora (0-23)
-        int minute;      // Minutele (0-59)
-        int duration;    // Durata în minute
+    public:
+        // Numarul de minute dintr-o zi
+        static constexpr int MINUTES_PER_DAY = 24 * 60;
         
-        TimeSlot();
-        TimeSlot(int h, int m, int d);
+        // Cea mai mare durata care incape in campul de 16 biti
+        static constexpr int MAX_DURATION = 0xFFFF;
+        
+        // Zilele pentru care minutul absolut de start si de final incap in 32 de biti (nucleul de suprapuneri
+        // le stocheaza asa); programul nu accepta intervale in afara lor
+        static constexpr int MAX_DAY = (INT32_MAX - MAX_DURATION) / MINUTES_PER_DAY - 1;
+        static constexpr int MIN_DAY = -MAX_DAY;
+        
+    private:
+        std::uint64_t m_packed;
+        
+        static constexpr int ClampDuration(int duration) {
+            return duration < 0 ? 0 : (duration > MAX_DURATION ? MAX_DURATION : duration);
+        }
+        
+        static constexpr std::uint64_t Pack(int day, int startMinute, int duration) {
+            // Impartire cu rotunjire in jos, ca minutele negative sa ajunga in ziua anterioara
+            int dayOffset = startMinute >= 0 ? startMinute / MINUTES_PER_DAY
+                                             : -((-(startMinute + 1)) / MINUTES_PER_DAY) - 1;
+            int minute = startMinute - dayOffset * MINUTES_PER_DAY;
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(day + dayOffset)) << 32) |
+                   (static_cast<std::uint64_t>(minute) << 16) |
+                   static_cast<std::uint64_t>(ClampDuration(duration));
+        }
+        
+    public:
+        constexpr TimeSlot() : m_packed(0) {}
+        constexpr TimeSlot(int h, int m, int d) : m_packed(Pack(0, h * 60 + m, d)) {}
+        constexpr TimeSlot(int day, int h, int m, int d) : m_packed(Pack(day, h * 60 + m, d)) {}
+        
+        // Construieste un interval direct din minutul de start al zilei
+        static constexpr TimeSlot FromMinutes(int day, int startMinute, int duration) {
+            return TimeSlot(day, 0, startMinute, duration);
+        }
+        
+        // Getteri
+        constexpr int GetDay() const { return static_cast<int>(m_packed >> 32); }
+        constexpr int GetStartMinute() const { return static_cast<int>((m_packed >> 16) & 0xFFFF); }
+        constexpr int GetDuration() const { return static_cast<int>(m_packed & 0xFFFF); }
+        constexpr int GetHour() const { return GetStartMinute() / 60; }
+        constexpr int GetMinute() const { return GetStartMinute() % 60; }
+        constexpr int GetEndMinute() const { return GetStartMinute() + GetDuration(); }
+        constexpr std::uint64_t GetPacked() const { return m_packed; }
+        
+        // Minutul absolut (de la ziua 0) la care incepe, respectiv se termina intervalul
+        constexpr std::int64_t GetAbsoluteStart() const {
+            return static_cast<std::int64_t>(GetDay()) * MINUTES_PER_DAY + GetStartMinute();
+        }
+        constexpr std::int64_t GetAbsoluteEnd() const { return GetAbsoluteStart() + GetDuration(); }
+        
+        // Ziua este in [MIN_DAY, MAX_DAY]
+        constexpr bool IsInDayRange() const { return GetDay() >= MIN_DAY && GetDay() <= MAX_DAY; }
+        
+        // Setteri
+        constexpr void SetDuration(int d) { m_packed = (m_packed & ~std::uint64_t(0xFFFF)) | static_cast<std::uint64_t>(ClampDuration(d)); }
+        constexpr void SetDay(int day) { m_packed = Pack(day, GetStartMinute(), GetDuration()); }
         
         // Verifica daca acest interval se suprapune cu altul
-        bool OverlapsWith(const TimeSlot& other) const;
+        constexpr bool OverlapsWith(const TimeSlot& other) const {
+            return GetAbsoluteStart() < other.GetAbsoluteEnd() && other.GetAbsoluteStart() < GetAbsoluteEnd();
+        }
         
         // Converteste intervalul de timp in string pentru afisare
         std::string ToString() const;
+        
+        // Egalitatea compara cuvantul codificat; ordinea este (zi, ora de start, durata), cu ziua comparata cu semn
+        // (cuvantul fara semn ar pune zilele negative dupa cele pozitive)
+        friend constexpr bool operator==(const TimeSlot& lhs, const TimeSlot& rhs) { return lhs.m_packed == rhs.m_packed; }
+        friend constexpr bool operator!=(const TimeSlot& lhs, const TimeSlot& rhs) { return lhs.m_packed != rhs.m_packed; }
+        friend constexpr bool operator<(const TimeSlot& lhs, const TimeSlot& rhs) {
+            return lhs.GetDay() != rhs.GetDay() ? lhs.GetDay() < rhs.GetDay()
+                                                : (lhs.m_packed & 0xFFFFFFFFu) < (rhs.m_packed & 0xFFFFFFFFu);
+        }
     };
 
+    static_assert(sizeof(TimeSlot) == sizeof(std::uint64_t), "TimeSlot trebuie sa ocupe un singur cuvant de 64 de biti");
+    static_assert(std::is_trivially_copyable<TimeSlot>::value, "TimeSlot trebuie sa fie trivial copiabil");
+    
     // Structura pentru detaliile serviciilor oferite
     struct ServiceDetails {
         int duration;               
@@ -41,6 +115,34 @@ namespace Beauty_Salon {
         MASSAGE,      
         OTHER         
     };
+    
+    // Numarul de valori din ServiceType (pentru tablouri indexate dupa tip)
+    constexpr int SERVICE_TYPE_COUNT = static_cast<int>(ServiceType::OTHER) + 1;
+    
+    // Multime de tipuri de servicii, cate un bit pentru fiecare tip
+    using ServiceTypeMask = std::uint32_t;
+    
+    constexpr ServiceTypeMask ServiceTypeBit(ServiceType type) {
+        return ServiceTypeMask(1) << static_cast<int>(type);
+    }
+    
+    // Masca pentru o lista de tipuri, ex. ServiceTypesMask({ServiceType::HAIR_CUT, ServiceType::MANICURE})
+    constexpr ServiceTypeMask ServiceTypesMask(std::initializer_list<ServiceType> types) {
+        ServiceTypeMask mask = 0;
+        for (ServiceType type : types) {
+            mask |= ServiceTypeBit(type);
+        }
+        return mask;
+    }
+    
+    // Enumerare pentru starea programarii
+    enum class AppointmentStatus {
+        SCHEDULED,      
+        IN_PROGRESS,    
+        COMPLETED,      
+        CANCELLED,      
+        NO_SHOW         
+    };
 }
 
 #endif // UTILS_H
\ No newline at end of file
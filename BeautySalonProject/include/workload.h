@@ -0,0 +1,153 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include "schedule.h"
+#include "service_catalog.h"
+#include "employee.h"
+#include "client.h"
+#include "inventory.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace Beauty_Salon {
+    // Generator pseudo-aleator rapid si determinist (splitmix64); aceeasi samanta da aceeasi secventa pe orice platforma
+    class SplitMix64 {
+    private:
+        std::uint64_t m_state;
+        
+    public:
+        explicit SplitMix64(std::uint64_t seed) : m_state(seed) {}
+        
+        std::uint64_t Next() {
+            std::uint64_t z = (m_state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+        
+        // Numar in [0, bound), prin inmultire (fara impartire)
+        std::uint32_t NextBelow(std::uint32_t bound) {
+            return static_cast<std::uint32_t>(((Next() >> 32) * bound) >> 32);
+        }
+        
+        // Numar real in [0, 1)
+        double NextDouble() {
+            return static_cast<double>(Next() >> 11) * (1.0 / 9007199254740992.0);
+        }
+    };
+    
+    enum class WorkloadEventType {
+        BOOK,
+        CANCEL,
+        COMPLETE,
+        NO_SHOW
+    };
+    
+    // Un eveniment din traficul salonului. Programarile sunt numerotate in ordinea evenimentelor BOOK (de la 0);
+    // evenimentele CANCEL / COMPLETE / NO_SHOW indica programarea prin acest numar
+    struct WorkloadEvent {
+        WorkloadEventType type;
+        std::uint32_t booking;
+        int day;                    // Ziua programarii
+        int minute;                 // Minutul de start din zi (BOOK)
+        int client;                 // Indexul clientului (BOOK)
+        int service;                // Indexul serviciului in meniul salonului (SALON_MENU) (BOOK)
+        int employee;               // Indexul angajatului cerut de client, sau -1 pentru alegere automata (BOOK)
+    };
+    
+    // Parametrii generatorului
+    struct WorkloadConfig {
+        std::uint64_t seed;
+        int clientCount;
+        int stylistCount;               // Stilistii cu index par pot face si vopsit
+        int technicianCount;
+        int productCount;
+        int firstDay;                   // Cel putin 0
+        int dayCount;                   // Zilele in care se fac (si au loc) programari
+        int bookingsPerDay;             // Programari facute in medie intr-o zi
+        int maxLeadDays;                // Cu cate zile inainte se poate programa un client (cel mult 14)
+        double cancelRate;
+        double noShowRate;
+        double requestedEmployeeRate;   // Partea programarilor la un angajat anume
+        int openHour;
+        int closeHour;
+        
+        WorkloadConfig();
+    };
+    
+    // Contoarele evenimentelor generate si ale celor respinse la aplicarea pe program
+    struct WorkloadStats {
+        std::uint64_t events;
+        std::uint64_t bookings;
+        std::uint64_t cancellations;
+        std::uint64_t completions;
+        std::uint64_t noShows;
+        std::uint64_t rejectedBookings;     // Programari refuzate de Schedule (StreamInto)
+        
+        WorkloadStats();
+    };
+    
+    // Generator determinist de date si trafic pentru teste la scara: clienti, personal cu specializari, meniul de
+    // servicii, produse si luni de programari, anulari, finalizari si neprezentari. Orele de start urmeaza un profil
+    // zilnic cu varfuri la pranz si dupa-amiaza, sambata e cea mai aglomerata zi, duminica salonul e inchis, iar
+    // serviciile respecta un amestec tipic (tunsul domina). Evenimentele sunt generate pe zile, in ordinea in care
+    // ar ajunge la salon: programarile facute azi (pentru azi sau zilele urmatoare), apoi anularile si rezultatele zilei
+    class WorkloadGenerator {
+    private:
+        // Zilele urmarite pentru anulari si rezultate (trebuie sa depaseasca maxLeadDays)
+        static constexpr int PENDING_DAYS = 16;
+        
+        WorkloadConfig m_config;
+        SplitMix64 m_rng;
+        std::vector<std::uint16_t> m_minute_table;          // Cuantilele profilului zilnic (minut de start)
+        std::vector<std::uint8_t> m_service_table;          // Cuantilele amestecului de servicii
+        std::vector<WorkloadEvent> m_pending[PENDING_DAYS]; // Anularile si rezultatele, pe zile
+        std::vector<WorkloadEvent> m_day_events;            // Evenimentele zilei curente
+        std::size_t m_next_event;
+        int m_day;                                          // Urmatoarea zi de generat
+        std::uint32_t m_bookings;
+        WorkloadStats m_stats;
+        std::vector<int> m_appointment_ids;                 // ID-ul programarii create de StreamInto (0 = respinsa)
+        bool m_wrote_header;
+        
+        void _BuildTables();
+        void _GenerateDay();
+        
+        // Angajatul cerut pentru serviciu (-1 daca nu se cere unul sau nu exista un angajat potrivit)
+        int _PickEmployee(int service);
+        
+    public:
+        explicit WorkloadGenerator(const WorkloadConfig& config);
+        
+        const WorkloadConfig& GetConfig() const;
+        const WorkloadStats& GetStats() const;
+        
+        // Reia secventa de la inceput (aceleasi evenimente)
+        void Reset();
+        
+        // Creeaza meniul salonului, personalul, clientii si produsele descrise de configuratie.
+        // Indexurile din evenimente se refera la ordinea din aceste colectii
+        void PopulateSalon(ServiceCatalog& catalog, std::vector<std::unique_ptr<Employee>>& employees,
+                           std::vector<Client>& clients, Inventory& inventory) const;
+        
+        // Urmatorul eveniment; false dupa ultima zi
+        bool Next(WorkloadEvent& event);
+        
+        // Aplica cel mult maxEvents evenimente direct pe program (colectiile create de PopulateSalon).
+        // Intoarce numarul de evenimente consumate; poate fi apelata repetat pentru a continua fluxul
+        std::size_t StreamInto(Schedule& schedule, const ServiceCatalog& catalog,
+                               const std::vector<std::unique_ptr<Employee>>& employees,
+                               const std::vector<Client>& clients, std::size_t maxEvents = SIZE_MAX);
+        
+        // Scrie cel mult maxEvents evenimente ca fisier de comenzi pentru CommandProcessor (book / cancel / complete /
+        // noshow, programarile fiind indicate prin @numar). Fisierul se executa pe un salon creat de PopulateSalon
+        // cu aceeasi configuratie (BeautySalon --workload <samanta> --batch <fisier>)
+        std::size_t WriteCommands(std::ostream& out, const std::vector<std::unique_ptr<Employee>>& employees,
+                                  std::size_t maxEvents = SIZE_MAX);
+    };
+}
+
+#endif // WORKLOAD_H
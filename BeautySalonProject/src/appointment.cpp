@@ -1,4 +1,6 @@
 #include "appointment.h"
+#include "discount_rules.h"
+#include "metrics.h"
 #include <iostream>
 #include <ctime>
 
@@ -14,13 +16,13 @@ namespace Beauty_Salon {
     Appointment::Appointment() 
         : m_id(GenerateID()), m_client(), m_employee(nullptr), m_service(nullptr),
           m_time_slot(), m_status(AppointmentStatus::SCHEDULED), m_notes(""),
-          m_total_price(0.0), m_is_confirmed(false) {
+          m_total_price(0.0), m_is_confirmed(false), m_consumption_sink(nullptr) {
     }
     
     Appointment::Appointment(const Client& client, Service* service, const TimeSlot& timeSlot) 
         : m_id(GenerateID()), m_client(client), m_employee(nullptr), m_service(service),
           m_time_slot(timeSlot), m_status(AppointmentStatus::SCHEDULED), m_notes(""),
-          m_total_price(0.0), m_is_confirmed(false) {
+          m_total_price(0.0), m_is_confirmed(false), m_consumption_sink(nullptr) {
         
         // Calculam pretul total
         CalculateTotalPrice();
@@ -29,7 +31,7 @@ namespace Beauty_Salon {
     Appointment::Appointment(const Client& client, Employee* employee, Service* service, const TimeSlot& timeSlot) 
         : m_id(GenerateID()), m_client(client), m_employee(employee), m_service(service),
           m_time_slot(timeSlot), m_status(AppointmentStatus::SCHEDULED), m_notes(""),
-          m_total_price(0.0), m_is_confirmed(false) {
+          m_total_price(0.0), m_is_confirmed(false), m_consumption_sink(nullptr) {
         
         // Calculam pretul total
         CalculateTotalPrice();
@@ -76,6 +78,10 @@ namespace Beauty_Salon {
         return m_is_confirmed;
     }
     
+    IConsumptionSink* Appointment::GetConsumptionSink() const {
+        return m_consumption_sink;
+    }
+    
     // Setteri
     void Appointment::SetEmployee(Employee* employee) {
         m_employee = employee;
@@ -87,7 +93,7 @@ namespace Beauty_Salon {
         m_service = service;
         // Actualizam durata programarii in functie de serviciu
         if (service) {
-            m_time_slot.duration = service->GetDuration();
+            m_time_slot.SetDuration(service->GetDuration());
         }
         // Recalculam prețul
         CalculateTotalPrice();
@@ -112,19 +118,26 @@ namespace Beauty_Salon {
         m_is_confirmed = confirmed;
     }
     
+    void Appointment::SetConsumptionSink(IConsumptionSink* sink) {
+        m_consumption_sink = sink;
+    }
+    
     // Metode pentru gestionarea programarii
     void Appointment::CalculateTotalPrice() {
+        SALON_MEASURE(APPOINTMENT_PRICE);
         if (m_service) {
-            // Calculam pretul serviciului
-            double basePrice = m_service->CalculatePrice();
-            
-            // Aplicam discount-ul clientului (daca exista)
-            m_total_price = m_client.ApplyDiscount(basePrice);
+            // Citim pretul precompilat al serviciului si aplicam discount-ul clientului (daca exista)
+            m_total_price = PricingEngine::Quote(m_service->GetPriceRecord(), m_client.GetDiscountRate());
         } else {
             m_total_price = 0.0;
         }
     }
     
+    void Appointment::CalculateTotalPrice(const DiscountProgram& discounts) {
+        SALON_MEASURE(APPOINTMENT_PRICE);
+        m_total_price = m_service ? discounts.Evaluate(MakeLineItem(*this)) : 0.0;
+    }
+    
     bool Appointment::CanReschedule() const {
         // Verificam daca programarea poate fi reprogramata, (doar daca statusul este SCHEDULED sau CANCELLED)
         return (m_status == AppointmentStatus::SCHEDULED || 
@@ -153,6 +166,15 @@ namespace Beauty_Salon {
         return false;
     }
     
+    bool Appointment::MarkNoShow() {
+        if (m_status == AppointmentStatus::SCHEDULED || 
+            m_status == AppointmentStatus::IN_PROGRESS) {
+            m_status = AppointmentStatus::NO_SHOW;
+            return true;
+        }
+        return false;
+    }
+    
     bool Appointment::Complete() {
         // Verificam dacă programarea poate fi marcata ca finalizata
         if (m_status == AppointmentStatus::SCHEDULED || 
@@ -162,26 +184,39 @@ namespace Beauty_Salon {
             // Adaugam o vizită clientului
             const_cast<Client&>(m_client).AddVisit();
             
+            // Anuntam consumul de produse al serviciului
+            if (m_consumption_sink) {
+                m_consumption_sink->OnAppointmentCompleted(*this);
+            }
+            
             return true;
         }
         return false;
     }
     
+    bool Appointment::Complete(const DiscountProgram& discounts) {
+        if (m_status != AppointmentStatus::SCHEDULED && m_status != AppointmentStatus::IN_PROGRESS) {
+            return false;
+        }
+        CalculateTotalPrice(discounts);
+        return Complete();
+    }
+    
     // Afisare informatii
     void Appointment::DisplayInfo() const {
-        std::cout << "Appointment #" << m_id << std::endl;
-        std::cout << "Client: " << m_client.GetName() << std::endl;
+        std::cout << "Appointment #" << m_id << "\n";
+        std::cout << "Client: " << m_client.GetName() << "\n";
         if (m_employee) {
-            std::cout << "Employee: " << m_employee->GetName() << std::endl;
+            std::cout << "Employee: " << m_employee->GetName() << "\n";
         } else {
-            std::cout << "Employee: Not assigned" << std::endl;
+            std::cout << "Employee: Not assigned" << "\n";
         }
         if (m_service) {
-            std::cout << "Service: " << m_service->GetName() << std::endl;
+            std::cout << "Service: " << m_service->GetName() << "\n";
         } else {
-            std::cout << "Service: Not specified" << std::endl;
+            std::cout << "Service: Not specified" << "\n";
         }
-        std::cout << "Time: " << m_time_slot.ToString() << std::endl;
+        std::cout << "Time: " << m_time_slot.ToString() << "\n";
         
         // Afisare status
         std::cout << "Status: ";
@@ -192,38 +227,40 @@ namespace Beauty_Salon {
             case AppointmentStatus::CANCELLED: std::cout << "Cancelled"; break;
             case AppointmentStatus::NO_SHOW: std::cout << "No Show"; break;
         }
-        std::cout << std::endl;
+        std::cout << "\n";
         
-        std::cout << "Confirmed: " << (m_is_confirmed ? "Yes" : "No") << std::endl;
-        std::cout << "Total Price: $" << m_total_price << std::endl;
+        std::cout << "Confirmed: " << (m_is_confirmed ? "Yes" : "No") << "\n";
+        std::cout << "Total Price: $" << m_total_price << "\n";
         
         if (!m_notes.empty()) {
-            std::cout << "Notes: " << m_notes << std::endl;
+            std::cout << "Notes: " << m_notes << "\n";
         }
     }
     
-    // Supraincarcarea operatorului <<
-    std::ostream& operator<<(std::ostream& os, const Appointment& appointment) {
-        os << "App #" << appointment.m_id << " - ";
-        os << appointment.m_client.GetName();
+    void Appointment::FormatTo(TextBuffer& out) const {
+        out.Append("App #").AppendInteger(m_id).Append(" - ").Append(m_client.GetName());
         
-        if (appointment.m_service) {
-            os << " - " << appointment.m_service->GetName();
+        if (m_service) {
+            out.Append(" - ").Append(m_service->GetName());
         }
         
-        os << " at " << appointment.m_time_slot.ToString();
+        out.Append(" at ").AppendTimeSlot(m_time_slot);
         
         // Status in format scurt
-        os << " [";
-        switch (appointment.m_status) {
-            case AppointmentStatus::SCHEDULED: os << "SCH"; break;
-            case AppointmentStatus::IN_PROGRESS: os << "INP"; break;
-            case AppointmentStatus::COMPLETED: os << "COM"; break;
-            case AppointmentStatus::CANCELLED: os << "CAN"; break;
-            case AppointmentStatus::NO_SHOW: os << "NOS"; break;
+        switch (m_status) {
+            case AppointmentStatus::SCHEDULED: out.Append(" [SCH]"); break;
+            case AppointmentStatus::IN_PROGRESS: out.Append(" [INP]"); break;
+            case AppointmentStatus::COMPLETED: out.Append(" [COM]"); break;
+            case AppointmentStatus::CANCELLED: out.Append(" [CAN]"); break;
+            case AppointmentStatus::NO_SHOW: out.Append(" [NOS]"); break;
         }
-        os << "]";
-        
+    }
+    
+    // Supraincarcarea operatorului <<
+    std::ostream& operator<<(std::ostream& os, const Appointment& appointment) {
+        TextBuffer buffer;
+        appointment.FormatTo(buffer);
+        buffer.WriteTo(os);
         return os;
     }
 }
@@ -0,0 +1,205 @@
+#include "booking_pipeline.h"
+#include <algorithm>
+
+namespace Beauty_Salon {
+    // Implementarea BookingResult
+    BookingResult::BookingResult()
+        : status(BookingStatus::REJECTED), appointmentId(0), employee(nullptr), slot() {
+    }
+    
+    // Implementarea BookingRequest
+    BookingRequest::BookingRequest(BookingOperation op, const Client& requestClient, Employee* requestEmployee,
+                                   Service* requestService, const TimeSlot& requestSlot, int id)
+        : operation(op), appointmentId(id), client(requestClient), employee(requestEmployee),
+          service(requestService), slot(requestSlot) {
+    }
+    
+    // Implementarea BookingPipelineStats
+    BookingPipelineStats::BookingPipelineStats()
+        : submitted(0), processed(0), accepted(0), batches(0), maxBatchSize(0) {
+    }
+    
+    double BookingPipelineStats::GetAverageBatchSize() const {
+        return batches ? static_cast<double>(processed) / batches : 0.0;
+    }
+    
+    // Implementarea BookingPipeline
+    BookingPipeline::BookingPipeline(Schedule& schedule, size_t queueCapacity, size_t maxBatch)
+        : m_schedule(schedule), m_queue(queueCapacity), m_max_batch(std::max<size_t>(1, maxBatch)),
+          m_worker_sleeping(false), m_stopping(false), m_active_producers(0), m_stop(false),
+          m_submitted(0), m_processed(0), m_accepted(0), m_batches(0), m_max_batch_seen(0) {
+        m_worker = std::thread(&BookingPipeline::_Run, this);
+    }
+    
+    BookingPipeline::~BookingPipeline() {
+        Stop();
+    }
+    
+    void BookingPipeline::_Run() {
+        std::vector<BookingRequest> batch;
+        batch.reserve(m_max_batch);
+        
+        while (true) {
+            batch.clear();
+            m_queue.ConsumeBatch(m_max_batch, [&batch](BookingRequest&& request) {
+                batch.push_back(std::move(request));
+            });
+            
+            if (batch.empty()) {
+                // Coada e goala: anuntam ca dormim, apoi verificam din nou (un producator poate fi intre push si notificare)
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_worker_sleeping.store(true);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_queue.IsEmpty()) {
+                    if (m_stop) {
+                        break;
+                    }
+                    m_wake.wait(lock, [this]() { return m_stop || !m_queue.IsEmpty(); });
+                }
+                m_worker_sleeping.store(false);
+                continue;
+            }
+            
+            // Fiecare rezultat este livrat imediat dupa aplicarea cererii, fara sa astepte restul lotului
+            std::uint64_t accepted = 0;
+            for (auto& request : batch) {
+                BookingResult result = _Apply(request);
+                if (result.IsAccepted()) {
+                    accepted++;
+                }
+                request.promise.set_value(result);
+            }
+            m_processed.fetch_add(batch.size(), std::memory_order_relaxed);
+            m_accepted.fetch_add(accepted, std::memory_order_relaxed);
+            m_batches.fetch_add(1, std::memory_order_relaxed);
+            if (batch.size() > m_max_batch_seen.load(std::memory_order_relaxed)) {
+                m_max_batch_seen.store(batch.size(), std::memory_order_relaxed);
+            }
+        }
+    }
+    
+    BookingResult BookingPipeline::_Apply(BookingRequest& request) {
+        BookingResult result;
+        switch (request.operation) {
+            case BookingOperation::BOOK: {
+                bool added = request.employee
+                    ? m_schedule.AddAppointment(request.client, request.employee, request.service, request.slot)
+                    : m_schedule.AddAppointment(request.client, request.service, request.slot);
+                if (added) {
+                    const Appointment& appointment = m_schedule.GetAppointments().back();
+                    result.status = BookingStatus::ACCEPTED;
+                    result.appointmentId = appointment.GetID();
+                    result.employee = appointment.GetEmployee();
+                    result.slot = appointment.GetTimeSlot();
+                }
+                break;
+            }
+            case BookingOperation::CANCEL:
+                // Ca in restul programului, anularea pastreaza programarea (CANCELLED), care poate fi reprogramata
+                if (m_schedule.CancelAppointment(request.appointmentId)) {
+                    result.status = BookingStatus::ACCEPTED;
+                    result.appointmentId = request.appointmentId;
+                } else {
+                    result.status = BookingStatus::NOT_FOUND;
+                }
+                break;
+            case BookingOperation::RESCHEDULE: {
+                const auto& appointments = m_schedule.GetAppointments();
+                bool exists = std::any_of(appointments.begin(), appointments.end(),
+                                          [&request](const Appointment& app) { return app.GetID() == request.appointmentId; });
+                if (!exists) {
+                    result.status = BookingStatus::NOT_FOUND;
+                } else if (m_schedule.RescheduleAppointment(request.appointmentId, request.slot)) {
+                    // Programarea mutata este adaugata la sfarsitul listei
+                    const Appointment& appointment = m_schedule.GetAppointments().back();
+                    result.status = BookingStatus::ACCEPTED;
+                    result.appointmentId = appointment.GetID();
+                    result.employee = appointment.GetEmployee();
+                    result.slot = appointment.GetTimeSlot();
+                }
+                break;
+            }
+        }
+        return result;
+    }
+    
+    std::future<BookingResult> BookingPipeline::_Submit(BookingRequest request) {
+        std::future<BookingResult> future = request.promise.get_future();
+        
+        // Stop asteapta iesirea tuturor producatorilor, deci o cerere acceptata aici ajunge sigur in coada inainte de oprire
+        m_active_producers.fetch_add(1);
+        if (m_stopping.load()) {
+            m_active_producers.fetch_sub(1);
+            BookingResult result;
+            result.status = BookingStatus::STOPPED;
+            request.promise.set_value(result);
+            return future;
+        }
+        
+        // Coada plina: asteptam ca firul de programare sa elibereze locuri
+        while (!m_queue.TryPush(std::move(request))) {
+            std::this_thread::yield();
+        }
+        m_submitted.fetch_add(1, std::memory_order_relaxed);
+        
+        // Trezim firul doar daca doarme; mutex-ul garanteaza ca nu este intre verificarea cozii si wait
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_worker_sleeping.load()) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_wake.notify_one();
+        }
+        
+        // Abia acum Stop poate continua (pipeline-ul nu mai este atins de acest apel)
+        m_active_producers.fetch_sub(1);
+        return future;
+    }
+    
+    std::future<BookingResult> BookingPipeline::Book(const Client& client, Service* service, const TimeSlot& slot) {
+        return _Submit(BookingRequest(BookingOperation::BOOK, client, nullptr, service, slot, 0));
+    }
+    
+    std::future<BookingResult> BookingPipeline::Book(const Client& client, Employee* employee, Service* service,
+                                                     const TimeSlot& slot) {
+        return _Submit(BookingRequest(BookingOperation::BOOK, client, employee, service, slot, 0));
+    }
+    
+    std::future<BookingResult> BookingPipeline::Cancel(int appointmentId) {
+        return _Submit(BookingRequest(BookingOperation::CANCEL, Client(), nullptr, nullptr, TimeSlot(), appointmentId));
+    }
+    
+    std::future<BookingResult> BookingPipeline::Reschedule(int appointmentId, const TimeSlot& newSlot) {
+        return _Submit(BookingRequest(BookingOperation::RESCHEDULE, Client(), nullptr, nullptr, newSlot, appointmentId));
+    }
+    
+    void BookingPipeline::Stop() {
+        if (m_stopping.exchange(true)) {
+            return;
+        }
+        
+        // Asteptam producatorii care au trecut deja de verificarea opririi
+        while (m_active_producers.load() > 0) {
+            std::this_thread::yield();
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_one();
+        m_worker.join();
+    }
+    
+    bool BookingPipeline::IsRunning() const {
+        return !m_stopping.load();
+    }
+    
+    BookingPipelineStats BookingPipeline::GetStats() const {
+        BookingPipelineStats stats;
+        stats.submitted = m_submitted.load(std::memory_order_relaxed);
+        stats.processed = m_processed.load(std::memory_order_relaxed);
+        stats.accepted = m_accepted.load(std::memory_order_relaxed);
+        stats.batches = m_batches.load(std::memory_order_relaxed);
+        stats.maxBatchSize = m_max_batch_seen.load(std::memory_order_relaxed);
+        return stats;
+    }
+}
@@ -4,7 +4,7 @@
 
 namespace Beauty_Salon {
     // Initializarea membrului static
-    int Client::m_total_clients = 0;
+    std::atomic<int> Client::m_total_clients(0);
     
     int Client::GetTotalClients() {
         return m_total_clients;
@@ -13,25 +13,32 @@ namespace Beauty_Salon {
     // Implementarea constructorilor
     Client::Client() 
         : m_name("Unknown"), m_phone(""), m_email(""), 
-          m_visits(0), m_is_vip(false), m_loyalty_points(0.0) {
+          m_visits(0), m_is_vip(false), m_loyalty_points(0.0), m_discount_rate(0.0) {
         m_total_clients++;
     }
     
     Client::Client(const std::string& name) 
         : m_name(name), m_phone(""), m_email(""), 
-          m_visits(0), m_is_vip(false), m_loyalty_points(0.0) {
+          m_visits(0), m_is_vip(false), m_loyalty_points(0.0), m_discount_rate(0.0) {
         m_total_clients++;
     }
     
     Client::Client(const std::string& name, const std::string& phone) 
         : m_name(name), m_phone(phone), m_email(""), 
-          m_visits(0), m_is_vip(false), m_loyalty_points(0.0) {
+          m_visits(0), m_is_vip(false), m_loyalty_points(0.0), m_discount_rate(0.0) {
         m_total_clients++;
     }
     
     Client::Client(const std::string& name, const std::string& phone, const std::string& email) 
         : m_name(name), m_phone(phone), m_email(email), 
-          m_visits(0), m_is_vip(false), m_loyalty_points(0.0) {
+          m_visits(0), m_is_vip(false), m_loyalty_points(0.0), m_discount_rate(0.0) {
+        m_total_clients++;
+    }
+    
+    Client::Client(const Client& other) 
+        : m_name(other.m_name), m_phone(other.m_phone), m_email(other.m_email), 
+          m_visits(other.m_visits), m_is_vip(other.m_is_vip), m_loyalty_points(other.m_loyalty_points), 
+          m_discount_rate(other.m_discount_rate) {
         m_total_clients++;
     }
     
@@ -40,7 +47,7 @@ namespace Beauty_Salon {
     }
     
     // Getteri si setteri
-    std::string Client::GetName() const {
+    const std::string& Client::GetName() const {
         return m_name;
     }
     
@@ -74,6 +81,7 @@ namespace Beauty_Salon {
     
     void Client::SetVIP(bool isVip) {
         m_is_vip = isVip;
+        _UpdateDiscountRate();
     }
     
     // Metodele pentru gestionarea vizitelor si a punctelor
@@ -84,6 +92,7 @@ namespace Beauty_Salon {
         if (m_visits >= 10 && !m_is_vip) {
             m_is_vip = true;
         }
+        _UpdateDiscountRate();
         
         // Adaugam puncte de loialitate pentru fiecare vizita (5 puncte)
         AddLoyaltyPoints(5.0);
@@ -103,8 +112,7 @@ namespace Beauty_Salon {
         return false;
     }
     
-    // Implementarea metodei din interfața IDiscountable
-    double Client::ApplyDiscount(double amount) {
+    void Client::_UpdateDiscountRate() {
         // Discount bazat pe statut VIP si numar de vizite
         double discount = 0.0;
         
@@ -115,24 +123,43 @@ namespace Beauty_Salon {
         // Discount suplimentar bazat pe numarul de vizite (max 5%)
         discount += std::min(5.0, static_cast<double>(m_visits) * 0.5);
         
+        m_discount_rate = discount;
+    }
+    
+    // Implementarea metodei din interfața IDiscountable
+    double Client::ApplyDiscount(double amount) {
         // Aplicam discount-ul la suma
-        return amount * (1.0 - discount / 100.0);
+        return amount * (1.0 - m_discount_rate / 100.0);
     }
     
     // Afisare informatii
     void Client::DisplayInfo() const {
-        std::cout << "Client: " << m_name << std::endl;
-        std::cout << "Phone: " << (m_phone.empty() ? "N/A" : m_phone) << std::endl;
-        std::cout << "Email: " << (m_email.empty() ? "N/A" : m_email) << std::endl;
-        std::cout << "Visits: " << m_visits << std::endl;
-        std::cout << "Status: " << (m_is_vip ? "VIP" : "Regular") << std::endl;
-        std::cout << "Loyalty Points: " << m_loyalty_points << std::endl;
+        std::cout << "Client: " << m_name << "\n";
+        std::cout << "Phone: " << (m_phone.empty() ? "N/A" : m_phone) << "\n";
+        std::cout << "Email: " << (m_email.empty() ? "N/A" : m_email) << "\n";
+        std::cout << "Visits: " << m_visits << "\n";
+        std::cout << "Status: " << (m_is_vip ? "VIP" : "Regular") << "\n";
+        std::cout << "Loyalty Points: " << m_loyalty_points << "\n";
+    }
+    
+    void Client::FormatTo(TextBuffer& out) const {
+        out.Append(m_name).Append(" (").Append(m_is_vip ? "VIP" : "Regular")
+           .Append(", ").AppendInteger(m_visits).Append(" visits)");
     }
     
     // Supraincarcare operator <<
     std::ostream& operator<<(std::ostream& os, const Client& client) {
-        os << client.m_name << " (" << (client.m_is_vip ? "VIP" : "Regular") 
-           << ", " << client.m_visits << " visits)";
+        TextBuffer buffer;
+        client.FormatTo(buffer);
+        buffer.WriteTo(os);
         return os;
     }
+    
+    void RenderClientList(TextBuffer& out, const std::vector<Client>& clients) {
+        for (size_t i = 0; i < clients.size(); ++i) {
+            out.AppendInteger(static_cast<long long>(i + 1)).Append(". ");
+            clients[i].FormatTo(out);
+            out.Append('\n');
+        }
+    }
 }
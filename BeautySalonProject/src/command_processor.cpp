@@ -0,0 +1,587 @@
+#include "command_processor.h"
+#include <algorithm>
+#include <charconv>
+#include <climits>
+
+namespace Beauty_Salon {
+    namespace {
+        // Numarul implicit de intervale intoarse de comanda slots si zilele cautate
+        constexpr long long DEFAULT_SLOT_COUNT = 5;
+        constexpr int SLOT_SEARCH_DAYS = 7;
+        
+        // Dimensiunea blocurilor citite din intrare
+        constexpr size_t READ_BLOCK_BYTES = 64 * 1024;
+        
+        bool NeedsQuotes(std::string_view value) {
+            return value.empty() || value.find_first_of(" \t\"") != std::string_view::npos;
+        }
+    }
+    
+    // Implementarea CommandStats
+    CommandStats::CommandStats() : lines(0), commands(0), errors(0) {
+    }
+    
+    // Implementarea CommandProcessor
+    CommandProcessor::CommandProcessor(ServiceCatalog& catalog, std::vector<std::unique_ptr<Employee>>& employees,
+                                       std::vector<Client>& clients, Inventory& inventory, Schedule& schedule)
+        : m_catalog(catalog), m_employees(employees), m_clients(clients), m_inventory(inventory), m_schedule(schedule),
+          m_format(ReportFormat::TEXT), m_report_writer(ReportFormat::TEXT), m_quit(false), m_out(nullptr) {
+    }
+    
+    ReportFormat CommandProcessor::GetFormat() const {
+        return m_format;
+    }
+    
+    void CommandProcessor::SetFormat(ReportFormat format) {
+        // Raspunsurile au doar formatele TEXT si JSON
+        m_format = format == ReportFormat::JSON ? ReportFormat::JSON : ReportFormat::TEXT;
+        m_report_writer.SetFormat(m_format);
+    }
+    
+    const CommandStats& CommandProcessor::GetStats() const {
+        return m_stats;
+    }
+    
+    bool CommandProcessor::IsQuitRequested() const {
+        return m_quit;
+    }
+    
+    void CommandProcessor::ClearQuitRequest() {
+        m_quit = false;
+    }
+    
+    void CommandProcessor::SwapBookingReferences(std::vector<int>& bookingIds) {
+        m_booking_ids.swap(bookingIds);
+    }
+    
+    size_t CommandProcessor::_Tokenize(std::string_view line, Token* tokens) {
+        size_t count = 0;
+        size_t pos = 0;
+        while (pos < line.size()) {
+            while (pos < line.size() && (line[pos] == ' ' || line[pos] == '\t')) {
+                ++pos;
+            }
+            if (pos == line.size()) {
+                break;
+            }
+            if (count == MAX_TOKENS) {
+                return MAX_TOKENS + 1;
+            }
+            
+            // Argumentele intre ghilimele pot contine spatii
+            size_t start = pos;
+            if (line[pos] == '"') {
+                start = ++pos;
+                while (pos < line.size() && line[pos] != '"') {
+                    ++pos;
+                }
+                tokens[count++] = line.substr(start, pos - start);
+                if (pos < line.size()) {
+                    ++pos;
+                }
+            } else {
+                while (pos < line.size() && line[pos] != ' ' && line[pos] != '\t') {
+                    ++pos;
+                }
+                tokens[count++] = line.substr(start, pos - start);
+            }
+        }
+        return count;
+    }
+    
+    bool CommandProcessor::_ParseInt(Token token, long long& value) {
+        const char* end = token.data() + token.size();
+        auto result = std::from_chars(token.data(), end, value);
+        return result.ec == std::errc() && result.ptr == end;
+    }
+    
+    bool CommandProcessor::_ParseTime(Token token, int& minuteOfDay) {
+        size_t colon = token.find(':');
+        long long hour = 0;
+        long long minute = 0;
+        if (colon == Token::npos || !_ParseInt(token.substr(0, colon), hour) || !_ParseInt(token.substr(colon + 1), minute)) {
+            return false;
+        }
+        if (hour < 0 || hour > 23 || minute < 0 || minute > 59) {
+            return false;
+        }
+        minuteOfDay = static_cast<int>(hour * 60 + minute);
+        return true;
+    }
+    
+    bool CommandProcessor::_ParseDay(Token token, int& day) {
+        // Programul accepta zile pana la TimeSlot::MAX_DAY, iar cautarea intervalelor aduna SLOT_SEARCH_DAYS la zi
+        long long value = 0;
+        if (!_ParseInt(token, value) || value < 0 || value > TimeSlot::MAX_DAY - SLOT_SEARCH_DAYS) {
+            return false;
+        }
+        day = static_cast<int>(value);
+        return true;
+    }
+    
+    bool CommandProcessor::_ParseAppointment(Token token, int& id) const {
+        long long value = 0;
+        if (token.empty() || token.front() != '@') {
+            if (!_ParseInt(token, value)) {
+                return false;
+            }
+            // Un ID care nu incape in int nu poate fi trunchiat la alta programare
+            id = value >= 1 && value <= INT_MAX ? static_cast<int>(value) : 0;
+            return true;
+        }
+        if (!_ParseInt(token.substr(1), value)) {
+            return false;
+        }
+        id = value >= 1 && value <= static_cast<long long>(m_booking_ids.size()) ? m_booking_ids[value - 1] : 0;
+        return true;
+    }
+    
+    void CommandProcessor::_BeginResponse(bool ok, Token command) {
+        if (m_format == ReportFormat::JSON) {
+            m_out->Append("{\"ok\":").Append(ok ? "true" : "false").Append(",\"command\":");
+            _AppendJsonString(command);
+        } else {
+            m_out->Append(ok ? "OK " : "ERR ").Append(command.data(), command.size());
+        }
+    }
+    
+    void CommandProcessor::_AppendJsonString(Token value) {
+        static const char hex[] = "0123456789abcdef";
+        m_out->Append('"');
+        for (char c : value) {
+            if (c == '"' || c == '\\') {
+                m_out->Append('\\').Append(c);
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                m_out->Append("\\u00", 4).Append(hex[(c >> 4) & 0xF]).Append(hex[c & 0xF]);
+            } else {
+                m_out->Append(c);
+            }
+        }
+        m_out->Append('"');
+    }
+    
+    void CommandProcessor::_Field(const char* key, long long value) {
+        if (m_format == ReportFormat::JSON) {
+            m_out->Append(",\"").Append(key).Append("\":").AppendInteger(value);
+        } else {
+            m_out->Append(' ').Append(key).Append('=').AppendInteger(value);
+        }
+    }
+    
+    void CommandProcessor::_Field(const char* key, Token value) {
+        if (m_format == ReportFormat::JSON) {
+            m_out->Append(",\"").Append(key).Append("\":");
+            _AppendJsonString(value);
+        } else if (NeedsQuotes(value)) {
+            m_out->Append(' ').Append(key).Append("=\"").Append(value.data(), value.size()).Append('"');
+        } else {
+            m_out->Append(' ').Append(key).Append('=').Append(value.data(), value.size());
+        }
+    }
+    
+    void CommandProcessor::_FieldSlot(const TimeSlot& slot) {
+        char time[6] = {
+            static_cast<char>('0' + slot.GetHour() / 10), static_cast<char>('0' + slot.GetHour() % 10), ':',
+            static_cast<char>('0' + slot.GetMinute() / 10), static_cast<char>('0' + slot.GetMinute() % 10), '\0'
+        };
+        _Field("day", slot.GetDay());
+        _Field("time", Token(time, 5));
+        _Field("duration", slot.GetDuration());
+    }
+    
+    void CommandProcessor::_EndResponse() {
+        if (m_format == ReportFormat::JSON) {
+            m_out->Append('}');
+        }
+        m_out->Append('\n');
+    }
+    
+    void CommandProcessor::_Error(Token command, const char* reason) {
+        m_stats.errors++;
+        _BeginResponse(false, command);
+        _Field("error", Token(reason));
+        _EndResponse();
+    }
+    
+    Employee* CommandProcessor::_FindEmployee(long long id) const {
+        for (const auto& employee : m_employees) {
+            if (employee->GetID() == id) {
+                return employee.get();
+            }
+        }
+        return nullptr;
+    }
+    
+    void CommandProcessor::_AddClient(const Token* args, size_t count) {
+        if (count < 2 || count > 4) {
+            _Error(args[0], "usage");
+            return;
+        }
+        std::string name(args[1]);
+        std::string phone = count > 2 ? std::string(args[2]) : std::string();
+        std::string email = count > 3 ? std::string(args[3]) : std::string();
+        m_clients.push_back(Client(name, phone, email));
+        
+        // Clientii sunt identificati prin pozitia lor (numerotata de la 1, ca in meniu)
+        _BeginResponse(true, args[0]);
+        _Field("id", static_cast<long long>(m_clients.size()));
+        _EndResponse();
+    }
+    
+    void CommandProcessor::_Book(const Token* args, size_t count) {
+        // Fiecare comanda book primeste un numar (@n), chiar daca este respinsa
+        m_booking_ids.push_back(0);
+        long long clientId = 0;
+        int day = 0;
+        int minute = 0;
+        if (count < 5 || count > 6 || !_ParseInt(args[1], clientId)) {
+            _Error(args[0], "usage");
+            return;
+        }
+        if (!_ParseDay(args[3], day)) {
+            _Error(args[0], "invalid_day");
+            return;
+        }
+        if (!_ParseTime(args[4], minute)) {
+            _Error(args[0], "invalid_time");
+            return;
+        }
+        if (clientId < 1 || clientId > static_cast<long long>(m_clients.size())) {
+            _Error(args[0], "unknown_client");
+            return;
+        }
+        Service* service = m_catalog.FindByName(std::string(args[2]));
+        if (!service) {
+            _Error(args[0], "unknown_service");
+            return;
+        }
+        Employee* employee = nullptr;
+        if (count == 6) {
+            long long employeeId = 0;
+            if (!_ParseInt(args[5], employeeId) || !(employee = _FindEmployee(employeeId))) {
+                _Error(args[0], "unknown_employee");
+                return;
+            }
+        }
+        
+        const Client& client = m_clients[clientId - 1];
+        TimeSlot slot = TimeSlot::FromMinutes(day, minute, service->GetDuration());
+        bool added = employee ? m_schedule.AddAppointment(client, employee, service, slot)
+                              : m_schedule.AddAppointment(client, service, slot);
+        if (!added) {
+            _Error(args[0], "rejected");
+            return;
+        }
+        
+        const Appointment& appointment = m_schedule.GetAppointments().back();
+        m_booking_ids.back() = appointment.GetID();
+        _BeginResponse(true, args[0]);
+        _Field("id", appointment.GetID());
+        _Field("employee", appointment.GetEmployee() ? appointment.GetEmployee()->GetID() : 0);
+        _FieldSlot(appointment.GetTimeSlot());
+        _Field("price_cents", static_cast<long long>(appointment.GetTotalPrice() * 100.0 + 0.5));
+        _EndResponse();
+    }
+    
+    void CommandProcessor::_Cancel(const Token* args, size_t count) {
+        int id = 0;
+        if (count != 2 || !_ParseAppointment(args[1], id)) {
+            _Error(args[0], "usage");
+            return;
+        }
+        if (!m_schedule.CancelAppointment(id)) {
+            _Error(args[0], "not_found");
+            return;
+        }
+        _BeginResponse(true, args[0]);
+        _Field("id", id);
+        _EndResponse();
+    }
+    
+    void CommandProcessor::_Complete(const Token* args, size_t count) {
+        int id = 0;
+        if (count != 2 || !_ParseAppointment(args[1], id)) {
+            _Error(args[0], "usage");
+            return;
+        }
+        if (!m_schedule.CompleteAppointment(id)) {
+            _Error(args[0], "not_found");
+            return;
+        }
+        _BeginResponse(true, args[0]);
+        _Field("id", id);
+        _EndResponse();
+    }
+    
+    void CommandProcessor::_NoShow(const Token* args, size_t count) {
+        int id = 0;
+        if (count != 2 || !_ParseAppointment(args[1], id)) {
+            _Error(args[0], "usage");
+            return;
+        }
+        if (!m_schedule.MarkNoShow(id)) {
+            _Error(args[0], "not_found");
+            return;
+        }
+        _BeginResponse(true, args[0]);
+        _Field("id", id);
+        _EndResponse();
+    }
+    
+    void CommandProcessor::_Reschedule(const Token* args, size_t count) {
+        int id = 0;
+        int day = 0;
+        int minute = 0;
+        if (count != 4 || !_ParseAppointment(args[1], id)) {
+            _Error(args[0], "usage");
+            return;
+        }
+        if (!_ParseDay(args[2], day)) {
+            _Error(args[0], "invalid_day");
+            return;
+        }
+        if (!_ParseTime(args[3], minute)) {
+            _Error(args[0], "invalid_time");
+            return;
+        }
+        
+        const auto& appointments = m_schedule.GetAppointments();
+        auto it = std::find_if(appointments.begin(), appointments.end(),
+                               [id](const Appointment& app) { return app.GetID() == id; });
+        if (it == appointments.end()) {
+            _Error(args[0], "not_found");
+            return;
+        }
+        TimeSlot slot = TimeSlot::FromMinutes(day, minute, it->GetTimeSlot().GetDuration());
+        if (!m_schedule.RescheduleAppointment(id, slot)) {
+            _Error(args[0], "rejected");
+            return;
+        }
+        _BeginResponse(true, args[0]);
+        _Field("id", id);
+        _FieldSlot(slot);
+        _EndResponse();
+    }
+    
+    void CommandProcessor::_Slots(const Token* args, size_t count) {
+        int day = 0;
+        long long slotCount = DEFAULT_SLOT_COUNT;
+        if (count < 3 || count > 4 || (count == 4 && !_ParseInt(args[3], slotCount)) || slotCount < 1) {
+            _Error(args[0], "usage");
+            return;
+        }
+        if (!_ParseDay(args[2], day)) {
+            _Error(args[0], "invalid_day");
+            return;
+        }
+        Service* service = m_catalog.FindByName(std::string(args[1]));
+        if (!service) {
+            _Error(args[0], "unknown_service");
+            return;
+        }
+        
+        std::vector<TimeSlot> slots = m_schedule.FindEarliestSlots(service, day, SLOT_SEARCH_DAYS,
+                                                                   static_cast<size_t>(slotCount));
+        _BeginResponse(true, args[0]);
+        _Field("count", static_cast<long long>(slots.size()));
+        if (m_format == ReportFormat::JSON) {
+            m_out->Append(",\"slots\":[");
+            for (size_t i = 0; i < slots.size(); ++i) {
+                m_out->Append(i ? ",[" : "[").AppendInteger(slots[i].GetDay()).Append(',')
+                      .AppendInteger(slots[i].GetStartMinute()).Append(']');
+            }
+            m_out->Append(']');
+        } else {
+            // Intervalele ca zi/minutul de start, separate prin virgula
+            m_out->Append(" slots=");
+            for (size_t i = 0; i < slots.size(); ++i) {
+                if (i > 0) {
+                    m_out->Append(',');
+                }
+                m_out->AppendInteger(slots[i].GetDay()).Append('/').AppendInteger(slots[i].GetStartMinute());
+            }
+        }
+        _EndResponse();
+    }
+    
+    void CommandProcessor::_Stock(Token command, const Token* args, size_t count) {
+        long long productId = 0;
+        long long quantity = 0;
+        if (count != 3 || !_ParseInt(args[1], productId) || !_ParseInt(args[2], quantity) || quantity < 1 ||
+            quantity > INT_MAX) {
+            _Error(command, "usage");
+            return;
+        }
+        if (productId < INT_MIN || productId > INT_MAX || !m_inventory.FindByID(static_cast<int>(productId))) {
+            _Error(command, "unknown_product");
+            return;
+        }
+        bool restock = command == "restock";
+        bool done = restock ? m_inventory.Restock(static_cast<int>(productId), static_cast<int>(quantity))
+                            : m_inventory.Consume(static_cast<int>(productId), static_cast<int>(quantity));
+        if (!done) {
+            _Error(command, restock ? "stock_overflow" : "insufficient_stock");
+            return;
+        }
+        _BeginResponse(true, command);
+        _Field("id", productId);
+        _Field("stock", m_inventory.FindByID(static_cast<int>(productId))->GetQuantity());
+        _EndResponse();
+    }
+    
+    void CommandProcessor::_Report(const Token* args, size_t count) {
+        long long hour = 0;
+        m_report_writer.Clear();
+        if (count == 3 && args[1] == "daily" && _ParseInt(args[2], hour)) {
+            m_report_writer.Write(m_schedule.BuildDailyReport(static_cast<int>(hour)));
+        } else if (count == 3 && args[1] == "schedule" && _ParseInt(args[2], hour)) {
+            m_report_writer.Write(m_schedule.BuildScheduleReport(static_cast<int>(hour)));
+        } else if (count == 2 && args[1] == "employees") {
+            std::vector<const Employee*> employees;
+            employees.reserve(m_employees.size());
+            for (const auto& employee : m_employees) {
+                employees.push_back(employee.get());
+            }
+            m_report_writer.Write(m_schedule.BuildEmployeeReports(employees));
+        } else if ((count == 2 || (count == 3 && args[2] == "reset")) && args[1] == "metrics") {
+            m_report_writer.Write(Metrics::TakeSnapshot());
+            if (count == 3) {
+                Metrics::Reset();
+            }
+        } else {
+            _Error(args[0], "usage");
+            return;
+        }
+        
+        // Raportul urmeaza raspunsului, pe numarul anuntat de linii
+        const TextBuffer& report = m_report_writer.GetBuffer();
+        std::string_view text(report.Data(), report.Size());
+        bool needsNewline = !text.empty() && text.back() != '\n';
+        long long lines = std::count(text.begin(), text.end(), '\n') + (needsNewline ? 1 : 0);
+        
+        _BeginResponse(true, args[0]);
+        _Field("type", args[1]);
+        _Field("lines", lines);
+        _EndResponse();
+        m_out->Append(report.Data(), report.Size());
+        if (needsNewline) {
+            m_out->Append('\n');
+        }
+    }
+    
+    void CommandProcessor::_Format(const Token* args, size_t count) {
+        if (count != 2 || (args[1] != "text" && args[1] != "json")) {
+            _Error(args[0], "usage");
+            return;
+        }
+        SetFormat(args[1] == "json" ? ReportFormat::JSON : ReportFormat::TEXT);
+        _BeginResponse(true, args[0]);
+        _Field("format", args[1]);
+        _EndResponse();
+    }
+    
+    void CommandProcessor::_Stats() {
+        _BeginResponse(true, "stats");
+        _Field("commands", static_cast<long long>(m_stats.commands));
+        _Field("errors", static_cast<long long>(m_stats.errors));
+        _Field("clients", static_cast<long long>(m_clients.size()));
+        _Field("appointments", static_cast<long long>(m_schedule.GetAppointments().size()));
+        _EndResponse();
+    }
+    
+    void CommandProcessor::ExecuteLine(std::string_view line, TextBuffer& out) {
+        m_stats.lines++;
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        
+        Token tokens[MAX_TOKENS];
+        size_t count = _Tokenize(line, tokens);
+        if (count == 0 || (!tokens[0].empty() && tokens[0].front() == '#')) {
+            return;
+        }
+        
+        m_out = &out;
+        m_stats.commands++;
+        if (count > MAX_TOKENS) {
+            _Error(tokens[0], "too_many_arguments");
+            return;
+        }
+        
+        Token command = tokens[0];
+        if (command == "book") {
+            _Book(tokens, count);
+        } else if (command == "cancel") {
+            _Cancel(tokens, count);
+        } else if (command == "complete") {
+            _Complete(tokens, count);
+        } else if (command == "noshow") {
+            _NoShow(tokens, count);
+        } else if (command == "reschedule") {
+            _Reschedule(tokens, count);
+        } else if (command == "client") {
+            _AddClient(tokens, count);
+        } else if (command == "slots") {
+            _Slots(tokens, count);
+        } else if (command == "restock" || command == "consume") {
+            _Stock(command, tokens, count);
+        } else if (command == "report") {
+            _Report(tokens, count);
+        } else if (command == "format") {
+            _Format(tokens, count);
+        } else if (command == "stats") {
+            _Stats();
+        } else if (command == "quit") {
+            m_quit = true;
+            _BeginResponse(true, command);
+            _EndResponse();
+        } else {
+            _Error(command, "unknown_command");
+        }
+    }
+    
+    void CommandProcessor::Run(std::istream& in, std::ostream& out, size_t flushBytes) {
+        std::vector<char> block(READ_BLOCK_BYTES);
+        std::string pending;                    // Linia incompleta de la sfarsitul blocului anterior
+        TextBuffer responses;
+        
+        while (!m_quit && in) {
+            in.read(block.data(), static_cast<std::streamsize>(block.size()));
+            size_t bytes = static_cast<size_t>(in.gcount());
+            if (bytes == 0) {
+                break;
+            }
+            
+            // Liniile complete sunt executate direct din bloc, fara copiere
+            size_t start = 0;
+            for (size_t i = 0; i < bytes && !m_quit; ++i) {
+                if (block[i] != '\n') {
+                    continue;
+                }
+                if (pending.empty()) {
+                    ExecuteLine(std::string_view(block.data() + start, i - start), responses);
+                } else {
+                    pending.append(block.data() + start, i - start);
+                    ExecuteLine(pending, responses);
+                    pending.clear();
+                }
+                start = i + 1;
+                
+                if (responses.Size() >= flushBytes) {
+                    responses.WriteTo(out);
+                    responses.Clear();
+                }
+            }
+            if (!m_quit) {
+                pending.append(block.data() + start, bytes - start);
+            }
+        }
+        
+        // Ultima linie poate sa nu se termine cu '\n'
+        if (!m_quit && !pending.empty()) {
+            ExecuteLine(pending, responses);
+        }
+        responses.WriteTo(out);
+        out.flush();
+    }
+}
@@ -0,0 +1,176 @@
+#include "consumption.h"
+#include "appointment.h"
+#include <functional>
+#include <thread>
+
+namespace Beauty_Salon {
+    namespace {
+        // Lista goala intoarsa pentru serviciile fara materiale
+        const std::vector<MaterialLine> NO_MATERIALS;
+        
+        // Dimensiunea implicita a unui lot de consum
+        constexpr size_t DEFAULT_BATCH_SIZE = 256;
+    }
+    
+    ConsumptionReport::ConsumptionReport() : eventsApplied(0), productsUpdated(0) {
+    }
+    
+    // Implementarea BillOfMaterials
+    BillOfMaterials::BillOfMaterials() {
+    }
+    
+    void BillOfMaterials::SetServiceMaterials(const Service* service, const std::vector<MaterialLine>& materials) {
+        if (service) {
+            m_by_service[service] = materials;
+        }
+    }
+    
+    void BillOfMaterials::SetTypeMaterials(ServiceType type, const std::vector<MaterialLine>& materials) {
+        m_by_type[static_cast<int>(type)] = materials;
+    }
+    
+    void BillOfMaterials::AddServiceMaterial(const Service* service, int productId, int uses) {
+        if (service && uses > 0) {
+            m_by_service[service].push_back(MaterialLine{productId, uses});
+        }
+    }
+    
+    const std::vector<MaterialLine>& BillOfMaterials::GetMaterials(const Service* service) const {
+        if (!service) {
+            return NO_MATERIALS;
+        }
+        auto it = m_by_service.find(service);
+        return it != m_by_service.end() ? it->second : m_by_type[static_cast<int>(service->GetType())];
+    }
+    
+    // Implementarea ConsumptionTracker
+    ConsumptionTracker::ConsumptionTracker(Inventory& inventory, const BillOfMaterials& materials, size_t shardCount) 
+        : m_inventory(inventory), m_materials(materials), m_pending_events(0), m_batch_size(DEFAULT_BATCH_SIZE) {
+        if (shardCount == 0) {
+            shardCount = 1;
+        }
+        for (size_t i = 0; i < shardCount; ++i) {
+            m_shards.emplace_back(new Shard());
+        }
+    }
+    
+    ConsumptionTracker::Shard& ConsumptionTracker::_LocalShard() {
+        // Fiecare fir scrie mereu in acelasi shard, deci firele diferite rareori se blocheaza reciproc,
+        // chiar daca folosesc acelasi produs
+        size_t hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+        return *m_shards[hash % m_shards.size()];
+    }
+    
+    void ConsumptionTracker::OnAppointmentCompleted(const Appointment& appointment) {
+        const std::vector<MaterialLine>& materials = m_materials.GetMaterials(appointment.GetService());
+        if (materials.empty()) {
+            return;
+        }
+        
+        // Toate materialele programarii intra in shard sub o singura blocare
+        Shard& shard = _LocalShard();
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (const auto& material : materials) {
+                shard.pending[material.productId] += material.uses;
+            }
+            shard.events += materials.size();
+        }
+        m_pending_events.fetch_add(materials.size(), std::memory_order_relaxed);
+    }
+    
+    void ConsumptionTracker::Record(const UsageEvent& event) {
+        if (event.uses <= 0) {
+            return;
+        }
+        
+        Shard& shard = _LocalShard();
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.pending[event.productId] += event.uses;
+            shard.events++;
+        }
+        m_pending_events.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    size_t ConsumptionTracker::GetPendingEvents() const {
+        return m_pending_events.load(std::memory_order_relaxed);
+    }
+    
+    size_t ConsumptionTracker::GetBatchSize() const {
+        return m_batch_size;
+    }
+    
+    void ConsumptionTracker::SetBatchSize(size_t batchSize) {
+        if (batchSize > 0) {
+            m_batch_size = batchSize;
+        }
+    }
+    
+    bool ConsumptionTracker::IsBatchReady() const {
+        return GetPendingEvents() >= m_batch_size;
+    }
+    
+    void ConsumptionTracker::_ApplyUsage(int productId, int uses, ConsumptionReport& report) {
+        auto* product = dynamic_cast<ProfessionalProduct*>(m_inventory.FindByID(productId));
+        if (!product) {
+            return;
+        }
+        
+        product->AddUsage(uses);
+        report.productsUpdated++;
+        
+        // O unitate uzata este inlocuita cu una noua din stoc; utilizarile in plus trec pe unitatea noua
+        int unitsReplaced = 0;
+        bool outOfStock = false;
+        while (product->NeedsReplacement()) {
+            if (!m_inventory.Consume(productId, 1)) {
+                outOfStock = true;
+                break;
+            }
+            product->SetUsageCount(product->GetUsageCount() - ProfessionalProduct::USES_PER_UNIT);
+            unitsReplaced++;
+        }
+        
+        if (unitsReplaced > 0) {
+            report.replacements.push_back(ReplacementSignal{productId, unitsReplaced, product->GetUsageCount()});
+        }
+        
+        // Semnalam doar produsele al caror stoc s-a schimbat in acest lot
+        int available = m_inventory.GetAvailable(productId);
+        int threshold = m_inventory.GetLowStockThreshold(productId);
+        if (outOfStock || (unitsReplaced > 0 && available < threshold)) {
+            report.reorders.push_back(ReorderSignal{productId, available, threshold, outOfStock});
+        }
+    }
+    
+    ConsumptionReport ConsumptionTracker::Flush() {
+        std::lock_guard<std::mutex> flushLock(m_flush_mutex);
+        ConsumptionReport report;
+        
+        // Golim shard-urile tinand fiecare blocare doar cat dureaza interschimbarea
+        std::unordered_map<int, int> drained;
+        for (auto& shard : m_shards) {
+            size_t events = 0;
+            {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                drained.swap(shard->pending);
+                events = shard->events;
+                shard->events = 0;
+            }
+            for (const auto& entry : drained) {
+                m_batch[entry.first] += entry.second;
+            }
+            drained.clear();
+            report.eventsApplied += events;
+        }
+        m_pending_events.fetch_sub(report.eventsApplied, std::memory_order_relaxed);
+        
+        // Fiecare produs este actualizat o singura data pe lot
+        for (const auto& entry : m_batch) {
+            _ApplyUsage(entry.first, entry.second, report);
+        }
+        m_batch.clear();
+        return report;
+    }
+}
@@ -0,0 +1,251 @@
+#include "discount_rules.h"
+#include "appointment.h"
+#include <algorithm>
+
+namespace Beauty_Salon {
+    namespace {
+        // Numarul de biti de categorie (servicii si produse)
+        constexpr int CATEGORY_BITS = 32;
+        
+        constexpr std::uint32_t TierBit(ClientTier tier) {
+            return std::uint32_t(1) << static_cast<int>(tier);
+        }
+    }
+    
+    // Implementarea LineItem
+    LineItem::LineItem() 
+        : price(0.0), categoryBit(0), minuteOfDay(0), tier(ClientTier::REGULAR), 
+          clientVisits(0), bundleId(0), onSale(false) {
+    }
+    
+    // Implementarea DiscountRule
+    DiscountRule::DiscountRule() 
+        : name(""), categoryMask(0xFFFFFFFFu), tierMask(0xFFFFFFFFu), 
+          startMinute(0), endMinute(TimeSlot::MINUTES_PER_DAY), minVisits(0), bundleId(-1), 
+          requiresSale(false), percent(0.0), perVisitPercent(0.0), maxPercent(100.0), 
+          group(DISCOUNT_GROUP_PROMOTION) {
+    }
+    
+    DiscountRule DiscountRule::Percent(const std::string& name, double percent) {
+        DiscountRule rule;
+        rule.name = name;
+        rule.percent = percent;
+        return rule;
+    }
+    
+    DiscountRule DiscountRule::ForClientTier(const std::string& name, ClientTier tier, double percent) {
+        DiscountRule rule = Percent(name, percent);
+        rule.tierMask = TierBit(tier);
+        rule.group = DISCOUNT_GROUP_CLIENT;
+        return rule;
+    }
+    
+    DiscountRule DiscountRule::Loyalty(const std::string& name, double perVisitPercent, double maxPercent) {
+        DiscountRule rule = Percent(name, 0.0);
+        rule.perVisitPercent = perVisitPercent;
+        rule.maxPercent = maxPercent;
+        rule.group = DISCOUNT_GROUP_CLIENT;
+        return rule;
+    }
+    
+    DiscountRule DiscountRule::TimeOfDay(const std::string& name, int startMinute, int endMinute, double percent) {
+        DiscountRule rule = Percent(name, percent);
+        rule.startMinute = startMinute;
+        rule.endMinute = endMinute;
+        return rule;
+    }
+    
+    DiscountRule DiscountRule::ForServiceType(const std::string& name, ServiceType type, double percent) {
+        DiscountRule rule = Percent(name, percent);
+        rule.categoryMask = ServiceTypeBit(type);
+        return rule;
+    }
+    
+    DiscountRule DiscountRule::ForBundle(const std::string& name, int bundleId, double percent) {
+        DiscountRule rule = Percent(name, percent);
+        rule.bundleId = bundleId;
+        rule.group = DISCOUNT_GROUP_BUNDLE;
+        return rule;
+    }
+    
+    DiscountRule DiscountRule::Sale(const std::string& name, double percent) {
+        DiscountRule rule = Percent(name, percent);
+        rule.categoryMask = ALL_PRODUCTS_MASK;
+        rule.requiresSale = true;
+        rule.group = DISCOUNT_GROUP_SALE;
+        return rule;
+    }
+    
+    DiscountRule& DiscountRule::WithCategories(std::uint32_t mask) {
+        categoryMask = mask;
+        return *this;
+    }
+    
+    DiscountRule& DiscountRule::WithTier(ClientTier tier) {
+        tierMask = TierBit(tier);
+        return *this;
+    }
+    
+    DiscountRule& DiscountRule::WithTimeWindow(int start, int end) {
+        startMinute = start;
+        endMinute = end;
+        return *this;
+    }
+    
+    DiscountRule& DiscountRule::WithMinVisits(int visits) {
+        minVisits = visits;
+        return *this;
+    }
+    
+    DiscountRule& DiscountRule::InGroup(int discountGroup) {
+        if (discountGroup >= 0 && discountGroup < MAX_DISCOUNT_GROUPS) {
+            group = discountGroup;
+        }
+        return *this;
+    }
+    
+    // Implementarea DiscountProgram
+    DiscountProgram::DiscountProgram() : m_bucket_start(CATEGORY_BITS + 1, 0) {
+    }
+    
+    DiscountProgram DiscountProgram::Compile(const std::vector<DiscountRule>& rules) {
+        DiscountProgram program;
+        
+        // Regulile cu un grup in afara [0, MAX_DISCOUNT_GROUPS) sunt ignorate (InGroup nu le poate produce,
+        // dar campul este public); Evaluate indexeaza direct tabloul de grupuri
+        std::vector<const DiscountRule*> compiled;
+        for (const auto& rule : rules) {
+            if (rule.group >= 0 && rule.group < MAX_DISCOUNT_GROUPS) {
+                compiled.push_back(&rule);
+            }
+        }
+        
+        for (const DiscountRule* rulePointer : compiled) {
+            const DiscountRule& rule = *rulePointer;
+            program.m_tier_mask.push_back(rule.tierMask);
+            program.m_start_minute.push_back(rule.startMinute);
+            program.m_end_minute.push_back(rule.endMinute);
+            program.m_min_visits.push_back(rule.minVisits);
+            program.m_bundle_id.push_back(rule.bundleId);
+            program.m_requires_sale.push_back(rule.requiresSale ? 1 : 0);
+            program.m_group.push_back(static_cast<std::uint8_t>(rule.group));
+            program.m_percent.push_back(rule.percent);
+            program.m_per_visit_percent.push_back(rule.perVisitPercent);
+            program.m_max_percent.push_back(rule.maxPercent);
+        }
+        
+        // Indexam regulile dupa bitul de categorie (pastrand ordinea regulilor in fiecare lista)
+        for (int bit = 0; bit < CATEGORY_BITS; ++bit) {
+            program.m_bucket_start[bit] = static_cast<std::uint32_t>(program.m_bucket_rules.size());
+            for (size_t r = 0; r < compiled.size(); ++r) {
+                if ((compiled[r]->categoryMask >> bit) & 1u) {
+                    program.m_bucket_rules.push_back(static_cast<std::uint32_t>(r));
+                }
+            }
+        }
+        program.m_bucket_start[CATEGORY_BITS] = static_cast<std::uint32_t>(program.m_bucket_rules.size());
+        
+        return program;
+    }
+    
+    size_t DiscountProgram::GetRuleCount() const {
+        return m_percent.size();
+    }
+    
+    double DiscountProgram::Evaluate(const LineItem& item) const {
+        if (item.categoryBit == 0) {
+            return item.price;
+        }
+        
+        const int bit = __builtin_ctz(item.categoryBit);
+        const std::uint32_t tierBit = TierBit(item.tier);
+        double groupPercent[MAX_DISCOUNT_GROUPS] = {};
+        
+        for (std::uint32_t k = m_bucket_start[bit]; k < m_bucket_start[bit + 1]; ++k) {
+            const std::uint32_t r = m_bucket_rules[k];
+            const int bundle = m_bundle_id[r];
+            const bool matches = (m_tier_mask[r] & tierBit) != 0 &&
+                                 item.minuteOfDay >= m_start_minute[r] && item.minuteOfDay < m_end_minute[r] &&
+                                 item.clientVisits >= m_min_visits[r] &&
+                                 (!m_requires_sale[r] || item.onSale) &&
+                                 (bundle < 0 || (bundle == 0 ? item.bundleId != 0 : item.bundleId == bundle));
+            if (matches) {
+                double percent = m_percent[r] + m_per_visit_percent[r] * item.clientVisits;
+                groupPercent[m_group[r]] += std::min(m_max_percent[r], percent);
+            }
+        }
+        
+        // Grupurile se aplica multiplicativ
+        double price = item.price;
+        for (int g = 0; g < MAX_DISCOUNT_GROUPS; ++g) {
+            price *= 1.0 - std::min(100.0, groupPercent[g]) / 100.0;
+        }
+        return price;
+    }
+    
+    double DiscountProgram::EvaluateBatch(const LineItem* items, size_t count, double* prices) const {
+        double total = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            double price = Evaluate(items[i]);
+            if (prices) {
+                prices[i] = price;
+            }
+            total += price;
+        }
+        return total;
+    }
+    
+    double DiscountProgram::EvaluateBatch(const std::vector<LineItem>& items, std::vector<double>* prices) const {
+        if (prices) {
+            prices->resize(items.size());
+        }
+        return EvaluateBatch(items.data(), items.size(), prices ? prices->data() : nullptr);
+    }
+    
+    // Regulile standard
+    std::vector<DiscountRule> CreateStandardRules() {
+        std::vector<DiscountRule> rules;
+        rules.push_back(DiscountRule::ForClientTier("VIP", ClientTier::VIP, 10.0).WithCategories(ALL_SERVICES_MASK));
+        rules.push_back(DiscountRule::Loyalty("Loyalty", 0.5, 5.0).WithCategories(ALL_SERVICES_MASK));
+        rules.push_back(DiscountRule::Sale("Sale", PRODUCT_SALE_DISCOUNT));
+        return rules;
+    }
+    
+    // Construirea liniilor
+    LineItem MakeLineItem(const Appointment& appointment) {
+        LineItem item;
+        if (appointment.GetService()) {
+            const PriceRecord& record = appointment.GetService()->GetPriceRecord();
+            item.price = record.price;
+            item.categoryBit = ServiceTypeBit(record.type);
+        }
+        item.minuteOfDay = appointment.GetTimeSlot().GetStartMinute();
+        item.tier = appointment.GetClient().IsVIP() ? ClientTier::VIP : ClientTier::REGULAR;
+        item.clientVisits = appointment.GetClient().GetVisits();
+        return item;
+    }
+    
+    LineItem MakeLineItem(const Product& product, const Client* client, int minuteOfDay) {
+        LineItem item;
+        item.price = product.CalculateListPrice();
+        item.categoryBit = ProductCategoryBit(product.GetCategory());
+        item.minuteOfDay = minuteOfDay;
+        item.onSale = product.IsOnSale();
+        if (client) {
+            item.tier = client->IsVIP() ? ClientTier::VIP : ClientTier::REGULAR;
+            item.clientVisits = client->GetVisits();
+        }
+        return item;
+    }
+    
+    std::vector<LineItem> MakeLineItems(const std::vector<Appointment>& appointments) {
+        std::vector<LineItem> items;
+        items.reserve(appointments.size());
+        for (const auto& appointment : appointments) {
+            if (appointment.GetService()) {
+                items.push_back(MakeLineItem(appointment));
+            }
+        }
+        return items;
+    }
+}
@@ -16,27 +16,22 @@ namespace Beauty_Salon {
     
     // Metode protejate
     void Employee::_AddSpecialization(ServiceType type) {
-        // Verificam daca specializarea exista deja
-        for (const auto& spec : m_specializations) {
-            if (spec == type) return;
-        }
-        // Adaugam specializarea noua
-        m_specializations.push_back(type);
+        m_specializations |= ServiceTypeBit(type);
     }
     
     // Implementarea constructorilor
     Employee::Employee() 
-        : m_id(GenerateID()), m_name("Unknown"), m_role("General"), m_hourly_rate(15.0) {
+        : m_id(GenerateID()), m_name("Unknown"), m_role("General"), m_hourly_rate(15.0), m_specializations(0) {
         m_total_employees++;
     }
     
     Employee::Employee(const std::string& name) 
-        : m_id(GenerateID()), m_name(name), m_role("General"), m_hourly_rate(15.0) {
+        : m_id(GenerateID()), m_name(name), m_role("General"), m_hourly_rate(15.0), m_specializations(0) {
         m_total_employees++;
     }
     
     Employee::Employee(const std::string& name, const std::string& role, double hourlyRate) 
-        : m_id(GenerateID()), m_name(name), m_role(role), m_hourly_rate(hourlyRate) {
+        : m_id(GenerateID()), m_name(name), m_role(role), m_hourly_rate(hourlyRate), m_specializations(0) {
         m_total_employees++;
     }
     
@@ -67,13 +62,6 @@ namespace Beauty_Salon {
         }
     }
     
-    bool Employee::CanProvide(ServiceType type) const {
-        for (const auto& spec : m_specializations) {
-            if (spec == type) return true;
-        }
-        return false;
-    }
-    
     void Employee::DisplayInfo() const {
         std::cout << "Employee: " << m_name << std::endl;
         std::cout << "ID: " << m_id << std::endl;
@@ -81,14 +69,17 @@ namespace Beauty_Salon {
         std::cout << "Hourly Rate: $" << m_hourly_rate << std::endl;
         
         std::cout << "Specializations: ";
-        if (m_specializations.empty()) {
+        if (m_specializations == 0) {
             std::cout << "None";
         } else {
-            for (size_t i = 0; i < m_specializations.size(); ++i) {
-                if (i > 0) std::cout << ", ";
+            bool first = true;
+            for (int type = 0; type < SERVICE_TYPE_COUNT; ++type) {
+                if (!(m_specializations & ServiceTypeBit(static_cast<ServiceType>(type)))) continue;
+                if (!first) std::cout << ", ";
+                first = false;
                 
                 // Conversie de la enum la string
-                switch (m_specializations[i]) {
+                switch (static_cast<ServiceType>(type)) {
                     case ServiceType::HAIR_CUT: std::cout << "Hair Cut"; break;
                     case ServiceType::HAIR_COLOR: std::cout << "Hair Coloring"; break;
                     case ServiceType::MANICURE: std::cout << "Manicure"; break;
@@ -0,0 +1,109 @@
+#include "format.h"
+#include <charconv>
+#include <cstring>
+
+namespace Beauty_Salon {
+    // Functii de formatare
+    char* FormatInteger(char* out, long long value) {
+        return std::to_chars(out, out + NUMBER_MAX_CHARS, value).ptr;
+    }
+    
+    char* FormatPrice(char* out, double value) {
+        return std::to_chars(out, out + NUMBER_MAX_CHARS, value, std::chars_format::general, 6).ptr;
+    }
+    
+    char* FormatTimeSlot(char* out, const TimeSlot& slot) {
+        if (slot.GetDay() != 0) {
+            std::memcpy(out, "Day ", 4);
+            out = FormatInteger(out + 4, slot.GetDay());
+            *out++ = ',';
+            *out++ = ' ';
+        }
+        
+        // Ora si minutul pe cate doua cifre
+        int hour = slot.GetHour();
+        int minute = slot.GetMinute();
+        if (hour < 10) {
+            *out++ = '0';
+        }
+        out = FormatInteger(out, hour);
+        *out++ = ':';
+        *out++ = static_cast<char>('0' + minute / 10);
+        *out++ = static_cast<char>('0' + minute % 10);
+        
+        *out++ = ' ';
+        *out++ = '(';
+        out = FormatInteger(out, slot.GetDuration());
+        std::memcpy(out, " min)", 5);
+        return out + 5;
+    }
+    
+    // Implementarea TextBuffer
+    TextBuffer::TextBuffer() 
+        : m_heap(nullptr), m_data(m_inline), m_size(0), m_capacity(INLINE_CAPACITY) {
+    }
+    
+    void TextBuffer::_Reserve(std::size_t extra) {
+        if (m_size + extra <= m_capacity) {
+            return;
+        }
+        
+        std::size_t newCapacity = m_capacity * 2;
+        while (newCapacity < m_size + extra) {
+            newCapacity *= 2;
+        }
+        
+        std::unique_ptr<char[]> newData(new char[newCapacity]);
+        std::memcpy(newData.get(), m_data, m_size);
+        m_heap = std::move(newData);
+        m_data = m_heap.get();
+        m_capacity = newCapacity;
+    }
+    
+    TextBuffer& TextBuffer::Append(const char* text, std::size_t length) {
+        _Reserve(length);
+        std::memcpy(m_data + m_size, text, length);
+        m_size += length;
+        return *this;
+    }
+    
+    TextBuffer& TextBuffer::Append(const char* text) {
+        return Append(text, std::strlen(text));
+    }
+    
+    TextBuffer& TextBuffer::Append(const std::string& text) {
+        return Append(text.data(), text.size());
+    }
+    
+    TextBuffer& TextBuffer::Append(char c) {
+        _Reserve(1);
+        m_data[m_size++] = c;
+        return *this;
+    }
+    
+    TextBuffer& TextBuffer::AppendInteger(long long value) {
+        _Reserve(NUMBER_MAX_CHARS);
+        m_size = static_cast<std::size_t>(FormatInteger(m_data + m_size, value) - m_data);
+        return *this;
+    }
+    
+    TextBuffer& TextBuffer::AppendPrice(double value) {
+        _Reserve(NUMBER_MAX_CHARS);
+        m_size = static_cast<std::size_t>(FormatPrice(m_data + m_size, value) - m_data);
+        return *this;
+    }
+    
+    TextBuffer& TextBuffer::AppendTimeSlot(const TimeSlot& slot) {
+        _Reserve(TIME_SLOT_MAX_CHARS);
+        m_size = static_cast<std::size_t>(FormatTimeSlot(m_data + m_size, slot) - m_data);
+        return *this;
+    }
+    
+    void TextBuffer::WriteTo(std::ostream& os) const {
+        os.write(m_data, static_cast<std::streamsize>(m_size));
+    }
+    
+    std::string TextBuffer::ToString() const {
+        return std::string(m_data, m_size);
+    }
+}
@@ -0,0 +1,348 @@
+#include "inventory.h"
+#include "metrics.h"
+
+namespace Beauty_Salon {
+    namespace {
+        // Listele goale intoarse cand nu exista rezultate
+        const std::vector<Product*> NO_PRODUCTS;
+        
+        // Pragul implicit de stoc minim
+        constexpr int DEFAULT_LOW_STOCK_THRESHOLD = 3;
+    }
+    
+    Inventory::Inventory() 
+        : m_default_threshold(DEFAULT_LOW_STOCK_THRESHOLD), m_next_reservation_id(1) {
+    }
+    
+    Inventory::Inventory(int defaultThreshold) 
+        : m_default_threshold(defaultThreshold >= 0 ? defaultThreshold : 0), m_next_reservation_id(1) {
+    }
+    
+    // Metode private
+    void Inventory::_IndexProduct(Product* product) {
+        m_by_category[static_cast<int>(product->GetCategory())].push_back(product);
+        m_by_brand[product->GetBrand()].push_back(product);
+        
+        if (auto* professional = dynamic_cast<ProfessionalProduct*>(product)) {
+            m_by_supplier[professional->GetSupplier()].push_back(product);
+        }
+    }
+    
+    void Inventory::_UpdateLowStock(size_t index) {
+        std::lock_guard<std::mutex> lock(m_low_stock_mutex);
+        Product* product = m_products[index].get();
+        int available = product->GetQuantity() - m_reserved[index];
+        bool isLow = available < m_threshold[index];
+        bool wasLow = m_low_position[index] != NOT_LOW;
+        
+        if (isLow == wasLow) {
+            return;
+        }
+        
+        if (isLow) {
+            m_low_position[index] = m_low_stock.size();
+            m_low_stock.push_back(product);
+            for (const auto& listener : m_listeners) {
+                listener(*product, available);
+            }
+        } else {
+            // Eliminare in O(1): mutam ultimul element pe pozitia eliberata
+            size_t position = m_low_position[index];
+            Product* last = m_low_stock.back();
+            m_low_stock[position] = last;
+            m_low_position[m_index_of[last->GetID()]] = position;
+            m_low_stock.pop_back();
+            m_low_position[index] = NOT_LOW;
+        }
+    }
+    
+    bool Inventory::_TakeUnreserved(size_t index, int quantity) {
+        Product& product = *m_products[index];
+        if (!product.UpdateStock(-quantity, m_reserved[index])) {
+            return false;
+        }
+        
+        // O rezervare facuta in paralel poate sa fi vazut stocul de dinainte de scadere. Ambele parti verifica
+        // din nou dupa propria scriere (cu fence), deci cel putin una o vede pe cealalta si renunta
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (product.GetQuantity() < m_reserved[index]) {
+            product.UpdateStock(quantity);
+            SALON_COUNT_REJECTION(INSUFFICIENT_STOCK);
+            return false;
+        }
+        
+        // Scaderea stocului poate doar sa aduca produsul sub prag (fara blocare cat timp stocul ramane peste)
+        if (product.GetQuantity() - m_reserved[index] < m_threshold[index]) {
+            _UpdateLowStock(index);
+        }
+        return true;
+    }
+    
+    void Inventory::_ForgetReservation(const StockReservation& reservation) {
+        auto it = m_reservations_by_appointment.find(reservation.appointmentId);
+        if (it == m_reservations_by_appointment.end()) {
+            return;
+        }
+        
+        std::vector<int>& ids = it->second;
+        for (size_t i = 0; i < ids.size(); ++i) {
+            if (ids[i] == reservation.id) {
+                ids[i] = ids.back();
+                ids.pop_back();
+                break;
+            }
+        }
+        if (ids.empty()) {
+            m_reservations_by_appointment.erase(it);
+        }
+    }
+    
+    size_t Inventory::_FindIndex(int productId) const {
+        auto it = m_index_of.find(productId);
+        return it != m_index_of.end() ? it->second : NOT_LOW;
+    }
+    
+    // Gestionarea produselor
+    Product* Inventory::AddProduct(std::unique_ptr<Product> product) {
+        if (!product || m_index_of.count(product->GetID())) {
+            return nullptr;
+        }
+        
+        Product* raw = product.get();
+        size_t index = m_products.size();
+        m_index_of[raw->GetID()] = index;
+        m_products.push_back(std::move(product));
+        m_reserved.emplace_back(0);
+        m_threshold.push_back(m_default_threshold);
+        m_low_position.push_back(NOT_LOW);
+        _IndexProduct(raw);
+        _UpdateLowStock(index);
+        return raw;
+    }
+    
+    size_t Inventory::GetProductCount() const {
+        return m_products.size();
+    }
+    
+    const std::vector<std::unique_ptr<Product>>& Inventory::GetProducts() const {
+        return m_products;
+    }
+    
+    // Cautari
+    Product* Inventory::FindByID(int productId) const {
+        size_t index = _FindIndex(productId);
+        return index != NOT_LOW ? m_products[index].get() : nullptr;
+    }
+    
+    const std::vector<Product*>& Inventory::FindByCategory(ProductCategory category) const {
+        return m_by_category[static_cast<int>(category)];
+    }
+    
+    const std::vector<Product*>& Inventory::FindByBrand(const std::string& brand) const {
+        auto it = m_by_brand.find(brand);
+        return it != m_by_brand.end() ? it->second : NO_PRODUCTS;
+    }
+    
+    const std::vector<Product*>& Inventory::FindBySupplier(const std::string& supplier) const {
+        auto it = m_by_supplier.find(supplier);
+        return it != m_by_supplier.end() ? it->second : NO_PRODUCTS;
+    }
+    
+    // Stoc
+    int Inventory::GetAvailable(int productId) const {
+        size_t index = _FindIndex(productId);
+        return index != NOT_LOW ? m_products[index]->GetQuantity() - m_reserved[index] : 0;
+    }
+    
+    int Inventory::GetReserved(int productId) const {
+        size_t index = _FindIndex(productId);
+        return index != NOT_LOW ? m_reserved[index].load() : 0;
+    }
+    
+    bool Inventory::IsAvailable(int productId, int quantity) const {
+        return quantity >= 0 && GetAvailable(productId) >= quantity;
+    }
+    
+    bool Inventory::Restock(int productId, int quantity) {
+        size_t index = _FindIndex(productId);
+        if (index == NOT_LOW || quantity <= 0) {
+            return false;
+        }
+        
+        if (!m_products[index]->UpdateStock(quantity)) {
+            return false;
+        }
+        _UpdateLowStock(index);
+        return true;
+    }
+    
+    bool Inventory::Consume(int productId, int quantity) {
+        size_t index = _FindIndex(productId);
+        if (index == NOT_LOW || quantity <= 0) {
+            return false;
+        }
+        
+        // Stocul rezervat nu poate fi consumat
+        return _TakeUnreserved(index, quantity);
+    }
+    
+    bool Inventory::Sell(int productId, int quantity) {
+        size_t index = _FindIndex(productId);
+        if (index == NOT_LOW || quantity <= 0) {
+            return false;
+        }
+        return _TakeUnreserved(index, quantity);
+    }
+    
+    // Rezervari
+    int Inventory::Reserve(int productId, int quantity, int appointmentId) {
+        size_t index = _FindIndex(productId);
+        if (index == NOT_LOW || quantity <= 0) {
+            return 0;
+        }
+        
+        // Rezervam intai si verificam dupa (vezi _TakeUnreserved), ca o vanzare concurenta sa nu ia aceeasi cantitate
+        m_reserved[index] += quantity;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_products[index]->GetQuantity() < m_reserved[index]) {
+            m_reserved[index] -= quantity;
+            return 0;
+        }
+        
+        StockReservation reservation;
+        reservation.id = m_next_reservation_id++;
+        reservation.productId = productId;
+        reservation.appointmentId = appointmentId;
+        reservation.quantity = quantity;
+        
+        m_reservations[reservation.id] = reservation;
+        m_reservations_by_appointment[appointmentId].push_back(reservation.id);
+        _UpdateLowStock(index);
+        return reservation.id;
+    }
+    
+    bool Inventory::Commit(int reservationId) {
+        auto it = m_reservations.find(reservationId);
+        if (it == m_reservations.end()) {
+            return false;
+        }
+        
+        const StockReservation reservation = it->second;
+        size_t index = _FindIndex(reservation.productId);
+        if (index == NOT_LOW || !m_products[index]->UpdateStock(-reservation.quantity)) {
+            return false;
+        }
+        
+        m_reserved[index] -= reservation.quantity;
+        m_reservations.erase(it);
+        _ForgetReservation(reservation);
+        _UpdateLowStock(index);
+        return true;
+    }
+    
+    bool Inventory::Release(int reservationId) {
+        auto it = m_reservations.find(reservationId);
+        if (it == m_reservations.end()) {
+            return false;
+        }
+        
+        const StockReservation reservation = it->second;
+        size_t index = _FindIndex(reservation.productId);
+        if (index != NOT_LOW) {
+            m_reserved[index] -= reservation.quantity;
+        }
+        m_reservations.erase(it);
+        _ForgetReservation(reservation);
+        if (index != NOT_LOW) {
+            _UpdateLowStock(index);
+        }
+        return true;
+    }
+    
+    int Inventory::CommitAppointment(int appointmentId) {
+        auto it = m_reservations_by_appointment.find(appointmentId);
+        if (it == m_reservations_by_appointment.end()) {
+            return 0;
+        }
+        
+        // Copiem lista deoarece Commit o modifica
+        std::vector<int> ids = it->second;
+        int processed = 0;
+        for (int id : ids) {
+            if (Commit(id)) {
+                processed++;
+            }
+        }
+        return processed;
+    }
+    
+    int Inventory::ReleaseAppointment(int appointmentId) {
+        auto it = m_reservations_by_appointment.find(appointmentId);
+        if (it == m_reservations_by_appointment.end()) {
+            return 0;
+        }
+        
+        std::vector<int> ids = it->second;
+        int processed = 0;
+        for (int id : ids) {
+            if (Release(id)) {
+                processed++;
+            }
+        }
+        return processed;
+    }
+    
+    const StockReservation* Inventory::GetReservation(int reservationId) const {
+        auto it = m_reservations.find(reservationId);
+        return it != m_reservations.end() ? &it->second : nullptr;
+    }
+    
+    size_t Inventory::GetReservationCount() const {
+        return m_reservations.size();
+    }
+    
+    // Praguri de stoc minim
+    int Inventory::GetLowStockThreshold(int productId) const {
+        size_t index = _FindIndex(productId);
+        return index != NOT_LOW ? m_threshold[index] : 0;
+    }
+    
+    bool Inventory::SetLowStockThreshold(int productId, int threshold) {
+        size_t index = _FindIndex(productId);
+        if (index == NOT_LOW || threshold < 0) {
+            return false;
+        }
+        
+        m_threshold[index] = threshold;
+        _UpdateLowStock(index);
+        return true;
+    }
+    
+    void Inventory::SetDefaultLowStockThreshold(int threshold) {
+        if (threshold >= 0) {
+            m_default_threshold = threshold;
+        }
+    }
+    
+    const std::vector<Product*>& Inventory::GetLowStockProducts() const {
+        return m_low_stock;
+    }
+    
+    void Inventory::AddLowStockListener(LowStockListener listener) {
+        if (listener) {
+            m_listeners.push_back(std::move(listener));
+        }
+    }
+    
+    void Inventory::Reindex() {
+        for (auto& list : m_by_category) {
+            list.clear();
+        }
+        m_by_brand.clear();
+        m_by_supplier.clear();
+        for (size_t i = 0; i < m_products.size(); ++i) {
+            _IndexProduct(m_products[i].get());
+            _UpdateLowStock(i);
+        }
+    }
+}
@@ -1,7 +1,11 @@
 #include <iostream>
+#include <fstream>
 #include <memory>
 #include <vector>
 #include <string>
+#include <cstring>
+#include <cstdlib>
+#include <csignal>
 
 #include "service.h"
 #include "employee.h"
@@ -9,24 +13,32 @@
 #include "appointment.h"
 #include "schedule.h"
 #include "product.h"
+#include "inventory.h"
+#include "discount_rules.h"
+#include "service_catalog.h"
+#include "service_definitions.h"
+#include "command_processor.h"
+#include "salon_server.h"
+#include "workload.h"
 
 using namespace Beauty_Salon;
 
 // Functia pentru adaugarea datelor demonstrative in sistem, Populeaza sistemul cu servicii, angajati, clienti si produse
 void PopulateWithDemoData(
-    std::vector<std::unique_ptr<Service>>& services,
+    ServiceCatalog& catalog,
     std::vector<std::unique_ptr<Employee>>& employees,
     std::vector<Client>& clients,
-    std::vector<std::unique_ptr<Product>>& products,
+    Inventory& inventory,
     Schedule& schedule) {
     
-    // Adaugare servicii - folosind unique_ptr cu new
-    services.push_back(std::unique_ptr<Service>(new HairService("Tuns", 30.0, true, true)));
-    services.push_back(std::unique_ptr<Service>(new HairService("Vopsit", 80.0, true, false)));
-    services.push_back(std::unique_ptr<Service>(new NailService("Manichiura", 25.0, false, 10)));
-    services.push_back(std::unique_ptr<Service>(new NailService("Pedichiura", 35.0, true, 10)));
-    services.push_back(std::unique_ptr<Service>(new SpaService("Masaj Relaxare", 50.0, false, false)));
-    services.push_back(std::unique_ptr<Service>(new SpaService("Tratament Facial Premium", 75.0, true, true)));
+    // Adaugare servicii in catalog din meniul fix al salonului (definit la compilare)
+    catalog.AddService(std::unique_ptr<Service>(new MenuService<FindMenuIndex("Tuns")>()));
+    catalog.AddService(std::unique_ptr<Service>(new MenuService<FindMenuIndex("Vopsit")>()));
+    catalog.AddService(std::unique_ptr<Service>(new MenuService<FindMenuIndex("Manichiura")>()));
+    catalog.AddService(std::unique_ptr<Service>(new MenuService<FindMenuIndex("Pedichiura")>()));
+    catalog.AddService(std::unique_ptr<Service>(new MenuService<FindMenuIndex("Masaj Relaxare")>()));
+    catalog.AddService(std::unique_ptr<Service>(new MenuService<FindMenuIndex("Tratament Facial Premium")>()));
+    const auto& services = catalog.GetServices();
     
     // Adaugare angajati
     std::unique_ptr<Employee> stylista(new Stylist("Ana Maria", 25.0, true, 5));
@@ -44,6 +56,10 @@ void PopulateWithDemoData(
     employees.push_back(std::move(techniciana));
     employees.push_back(std::move(technicianb));
     
+    // Precalculam angajatii calificati pentru fiecare serviciu
+    catalog.BuildQualifications(employees);
+    schedule.SetServiceCatalog(&catalog);
+    
     // Adaugare clienti
     clients.push_back(Client("Andrei", "0722123456", "andrei@email.com"));
     clients.push_back(Client("Maria", "0733234567"));
@@ -54,16 +70,16 @@ void PopulateWithDemoData(
         clients[0].AddVisit();
     }
     
-    // Adaugare produse
-    products.push_back(std::unique_ptr<Product>(new RetailProduct("Sampon Revitalizant", "BrandX", 15.0, ProductCategory::HAIR_CARE, 0.4)));
-    products.push_back(std::unique_ptr<Product>(new RetailProduct("Balsam Nutritiv", "BrandX", 12.0, ProductCategory::HAIR_CARE, 0.4)));
-    products.push_back(std::unique_ptr<Product>(new RetailProduct("Crema Hidratanta", "SkinY", 25.0, ProductCategory::SKIN_CARE, 0.5)));
-    products.push_back(std::unique_ptr<Product>(new ProfessionalProduct("Vopsea profesionala", "ColorPro", 30.0, ProductCategory::HAIR_CARE, "SupplierZ")));
-    products.push_back(std::unique_ptr<Product>(new ProfessionalProduct("Ulei de masaj", "MassageX", 20.0, ProductCategory::SKIN_CARE, "SupplierW")));
+    // Adaugare produse in inventar
+    inventory.AddProduct(std::unique_ptr<Product>(new RetailProduct("Sampon Revitalizant", "BrandX", 15.0, ProductCategory::HAIR_CARE, 0.4)));
+    inventory.AddProduct(std::unique_ptr<Product>(new RetailProduct("Balsam Nutritiv", "BrandX", 12.0, ProductCategory::HAIR_CARE, 0.4)));
+    inventory.AddProduct(std::unique_ptr<Product>(new RetailProduct("Crema Hidratanta", "SkinY", 25.0, ProductCategory::SKIN_CARE, 0.5)));
+    inventory.AddProduct(std::unique_ptr<Product>(new ProfessionalProduct("Vopsea profesionala", "ColorPro", 30.0, ProductCategory::HAIR_CARE, "SupplierZ")));
+    inventory.AddProduct(std::unique_ptr<Product>(new ProfessionalProduct("Ulei de masaj", "MassageX", 20.0, ProductCategory::SKIN_CARE, "SupplierW")));
     
     // Actualizam stocul produselor
-    for (auto& product : products) {
-        product->UpdateStock(10); // Adaugam 10 bucati din fiecare produs
+    for (const auto& product : inventory.GetProducts()) {
+        inventory.Restock(product->GetID(), 10); // Adaugam 10 bucati din fiecare produs
     }
     
     // Crearea unor programari
@@ -99,9 +115,9 @@ void DisplayAllServices(const std::vector<std::unique_ptr<Service>>& services) {
         return;
     }
     
-    for (size_t i = 0; i < services.size(); ++i) {
-        std::cout << i + 1 << ". " << *services[i] << std::endl;
-    }
+    TextBuffer buffer;
+    RenderServiceList(buffer, services);
+    buffer.WriteTo(std::cout);
 }
 
 // Functia pentru afisarea tuturor angajatilor
@@ -125,9 +141,9 @@ void DisplayAllClients(const std::vector<Client>& clients) {
         return;
     }
     
-    for (size_t i = 0; i < clients.size(); ++i) {
-        std::cout << i + 1 << ". " << clients[i] << std::endl;
-    }
+    TextBuffer buffer;
+    RenderClientList(buffer, clients);
+    buffer.WriteTo(std::cout);
 }
 
 // Functia pentru afisarea tuturor produselor
@@ -138,9 +154,9 @@ void DisplayAllProducts(const std::vector<std::unique_ptr<Product>>& products) {
         return;
     }
     
-    for (size_t i = 0; i < products.size(); ++i) {
-        std::cout << i + 1 << ". " << *products[i] << std::endl;
-    }
+    TextBuffer buffer;
+    RenderProductList(buffer, products);
+    buffer.WriteTo(std::cout);
 }
 
 // Functia pentru demonstrarea operatorilor supraincarcati
@@ -163,17 +179,153 @@ void DemonstrateOperators(const std::vector<std::unique_ptr<Service>>& services,
     }
 }
 
+// Modul neinteractiv: executa comenzile din fisier (sau de la intrarea standard) si scrie raspunsurile la iesire
+int RunBatch(CommandProcessor& processor, const char* path) {
+    std::ios::sync_with_stdio(false);
+    if (!path) {
+        processor.Run(std::cin, std::cout);
+        return 0;
+    }
+    
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Nu se poate deschide fisierul " << path << "\n";
+        return 1;
+    }
+    processor.Run(file, std::cout);
+    return 0;
+}
+
+// Scrie traficul generat ca fisier de comenzi ("-" = iesirea standard)
+int WriteWorkload(WorkloadGenerator& generator, const std::vector<std::unique_ptr<Employee>>& employees, const char* path) {
+    std::ios::sync_with_stdio(false);
+    if (std::strcmp(path, "-") == 0) {
+        generator.WriteCommands(std::cout, employees);
+    } else {
+        std::ofstream file(path, std::ios::binary);
+        if (!file) {
+            std::cerr << "Nu se poate crea fisierul " << path << "\n";
+            return 1;
+        }
+        generator.WriteCommands(file, employees);
+    }
+    
+    const WorkloadStats& stats = generator.GetStats();
+    std::cerr << "Evenimente: " << stats.events << " (programari " << stats.bookings << ", anulari " << stats.cancellations
+              << ", finalizari " << stats.completions << ", neprezentari " << stats.noShows << ")\n";
+    return 0;
+}
+
+#ifdef __linux__
+// Serverul pornit de --serve, oprit la SIGINT / SIGTERM
+SalonServer* g_server = nullptr;
+
+void StopServer(int) {
+    if (g_server) {
+        g_server->Stop();
+    }
+}
+
+// Modul server: comenzile sosesc pe conexiuni TCP (doar pe loopback)
+int RunServer(CommandProcessor& processor, int port) {
+    SalonServer server(processor);
+    if (!server.Listen("127.0.0.1", static_cast<std::uint16_t>(port))) {
+        std::cerr << "Nu se poate asculta pe portul " << port << "\n";
+        return 1;
+    }
+    g_server = &server;
+    std::signal(SIGINT, StopServer);
+    std::signal(SIGTERM, StopServer);
+    std::cerr << "Serverul asculta pe 127.0.0.1:" << server.GetPort() << "\n";
+    
+    bool ok = server.Run();
+    g_server = nullptr;
+    
+    const SalonServerStats& stats = server.GetStats();
+    std::cerr << "Conexiuni: " << stats.accepted << " (maxim " << stats.maxConnections << " simultan), comenzi: "
+              << stats.commands << "\n";
+    return ok ? 0 : 1;
+}
+#endif
+
 // Functia principala a programului
-int main() {
+// Utilizare: BeautySalon [--workload samanta [--days n] [--generate fisier]] [--batch [fisier] | --serve [port]] [--format text|json]
+int main(int argc, char* argv[]) {
     // Colectii pentru stocarea datelor - folosim obiecte pe heap
-    std::vector<std::unique_ptr<Service>> services;
+    ServiceCatalog catalog;
     std::vector<std::unique_ptr<Employee>> employees;
     std::vector<Client> clients;  // Clientii sunt pe stack 
-    std::vector<std::unique_ptr<Product>> products;
+    Inventory inventory;
     Schedule schedule(9, 20, 5); // Program 9-20, max 5 programari simultane
     
-    // Populam sistemul cu date demo
-    PopulateWithDemoData(services, employees, clients, products, schedule);
+    // Programarile finalizate se incaseaza cu regulile de discount compilate
+    DiscountProgram discounts = DiscountProgram::Compile(CreateStandardRules());
+    schedule.SetDiscountProgram(&discounts);
+    
+    bool batch = false;
+    const char* batchPath = nullptr;
+    bool serve = false;
+    int port = 7070;
+    bool workload = false;
+    WorkloadConfig workloadConfig;
+    const char* generatePath = nullptr;
+    ReportFormat format = ReportFormat::TEXT;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--batch") == 0) {
+            batch = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                batchPath = argv[++i];
+            }
+        } else if (std::strcmp(argv[i], "--serve") == 0) {
+            serve = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                port = std::atoi(argv[++i]);
+            }
+        } else if (std::strcmp(argv[i], "--workload") == 0 && i + 1 < argc) {
+            workload = true;
+            workloadConfig.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--days") == 0 && i + 1 < argc) {
+            workloadConfig.dayCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--generate") == 0 && i + 1 < argc) {
+            generatePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+            format = std::strcmp(argv[++i], "json") == 0 ? ReportFormat::JSON : ReportFormat::TEXT;
+        } else {
+            std::cerr << "Utilizare: " << argv[0] << " [--workload samanta [--days n] [--generate fisier]]"
+                      << " [--batch [fisier] | --serve [port]] [--format text|json]\n";
+            return 1;
+        }
+    }
+    
+    if (workload) {
+        // Salon generat (aceeasi samanta = aceleasi date), cu cate un loc de lucru pentru fiecare angajat
+        WorkloadGenerator generator(workloadConfig);
+        generator.PopulateSalon(catalog, employees, clients, inventory);
+        schedule.SetServiceCatalog(&catalog);
+        schedule.SetMaxConcurrentAppointments(static_cast<int>(employees.size()));
+        if (generatePath) {
+            return WriteWorkload(generator, employees, generatePath);
+        }
+    } else {
+        // Populam sistemul cu date demo
+        PopulateWithDemoData(catalog, employees, clients, inventory, schedule);
+    }
+    
+    if (batch) {
+        CommandProcessor processor(catalog, employees, clients, inventory, schedule);
+        processor.SetFormat(format);
+        return RunBatch(processor, batchPath);
+    }
+    if (serve) {
+        CommandProcessor processor(catalog, employees, clients, inventory, schedule);
+        processor.SetFormat(format);
+#ifdef __linux__
+        return RunServer(processor, port);
+#else
+        std::cerr << "Modul server este disponibil doar pe Linux\n";
+        return 1;
+#endif
+    }
     
     int choice = -1;
     
@@ -184,7 +336,7 @@ int main() {
         
         switch (choice) {
             case 1: // Gestionare Servicii
-                DisplayAllServices(services);
+                DisplayAllServices(catalog.GetServices());
                 break;
                 
             case 2: // Gestionare Angajati
@@ -200,7 +352,7 @@ int main() {
                 break;
                 
             case 5: // Gestionare Produse
-                DisplayAllProducts(products);
+                DisplayAllProducts(inventory.GetProducts());
                 break;
                 
             case 6: // Rapoarte si Statistici
@@ -208,7 +360,7 @@ int main() {
                 schedule.GenerateDailyReport(10);
                 
                 // Demonstram functionalitatea operatorilor supraincarcati
-                DemonstrateOperators(services, products);
+                DemonstrateOperators(catalog.GetServices(), inventory.GetProducts());
                 break;
                 
             case 0:
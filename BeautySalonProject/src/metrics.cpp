@@ -0,0 +1,395 @@
+#include "metrics.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace Beauty_Salon {
+    const char* GetOperationName(MetricOperation operation) {
+        switch (operation) {
+            case MetricOperation::SCHEDULE_ADD: return "schedule.add";
+            case MetricOperation::SCHEDULE_REMOVE: return "schedule.remove";
+            case MetricOperation::SCHEDULE_FIND: return "schedule.find";
+            case MetricOperation::SCHEDULE_SUGGEST: return "schedule.suggest";
+            case MetricOperation::SCHEDULE_REPORT: return "schedule.report";
+            case MetricOperation::APPOINTMENT_PRICE: return "appointment.price";
+            case MetricOperation::PRODUCT_UPDATE_STOCK: return "product.update_stock";
+            case MetricOperation::COUNT: break;
+        }
+        return "unknown";
+    }
+    
+    const char* GetRejectionName(RejectionReason reason) {
+        switch (reason) {
+            case RejectionReason::OUTSIDE_WORKING_HOURS: return "outside_working_hours";
+            case RejectionReason::EMPLOYEE_CONFLICT: return "employee_conflict";
+            case RejectionReason::CAPACITY: return "capacity";
+            case RejectionReason::OFF_SHIFT: return "off_shift";
+            case RejectionReason::NO_EMPLOYEE: return "no_employee";
+            case RejectionReason::INSUFFICIENT_STOCK: return "insufficient_stock";
+            case RejectionReason::COUNT: break;
+        }
+        return "unknown";
+    }
+    
+    // Implementarea LatencyHistogram
+    size_t LatencyHistogram::BucketIndex(std::uint64_t value) {
+        if (value < static_cast<std::uint64_t>(SUB_BUCKET_COUNT)) {
+            return static_cast<size_t>(value);
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        int exponent = 63 - __builtin_clzll(value);
+#else
+        int exponent = 0;
+        for (std::uint64_t rest = value; rest > 1; rest >>= 1) {
+            exponent++;
+        }
+#endif
+        if (exponent > MAX_EXPONENT) {
+            return BUCKET_COUNT - 1;
+        }
+        int shift = exponent - SUB_BUCKET_BITS;
+        return static_cast<size_t>(SUB_BUCKET_COUNT + shift * SUB_BUCKET_COUNT) +
+               static_cast<size_t>((value >> shift) - SUB_BUCKET_COUNT);
+    }
+    
+    std::uint64_t LatencyHistogram::BucketUpperBound(size_t index) {
+        if (index < static_cast<size_t>(SUB_BUCKET_COUNT)) {
+            return index;
+        }
+        size_t shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+        std::uint64_t subBucket = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+        return ((subBucket + 1) << shift) - 1;
+    }
+    
+    LatencyHistogram::LatencyHistogram()
+        : m_buckets(BUCKET_COUNT, 0), m_count(0), m_sum(0), m_min(0), m_max(0) {
+    }
+    
+    void LatencyHistogram::Record(std::uint64_t nanoseconds) {
+        m_buckets[BucketIndex(nanoseconds)]++;
+        m_min = m_count == 0 ? nanoseconds : std::min(m_min, nanoseconds);
+        m_max = std::max(m_max, nanoseconds);
+        m_sum += nanoseconds;
+        m_count++;
+    }
+    
+    void LatencyHistogram::Merge(const LatencyHistogram& other) {
+        if (other.m_count == 0) {
+            return;
+        }
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            m_buckets[i] += other.m_buckets[i];
+        }
+        m_min = m_count == 0 ? other.m_min : std::min(m_min, other.m_min);
+        m_max = std::max(m_max, other.m_max);
+        m_sum += other.m_sum;
+        m_count += other.m_count;
+    }
+    
+    void LatencyHistogram::Clear() {
+        std::fill(m_buckets.begin(), m_buckets.end(), 0);
+        m_count = 0;
+        m_sum = 0;
+        m_min = 0;
+        m_max = 0;
+    }
+    
+    std::uint64_t LatencyHistogram::GetCount() const {
+        return m_count;
+    }
+    
+    std::uint64_t LatencyHistogram::GetMin() const {
+        return m_min;
+    }
+    
+    std::uint64_t LatencyHistogram::GetMax() const {
+        return m_max;
+    }
+    
+    std::uint64_t LatencyHistogram::GetMean() const {
+        return m_count == 0 ? 0 : m_sum / m_count;
+    }
+    
+    std::uint64_t LatencyHistogram::GetPercentile(double percent) const {
+        if (m_count == 0) {
+            return 0;
+        }
+        // Rangul masuratorii cautate (cel putin prima)
+        double rank = std::ceil(std::min(std::max(percent, 0.0), 100.0) / 100.0 * static_cast<double>(m_count));
+        std::uint64_t target = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(rank));
+        std::uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            seen += m_buckets[i];
+            if (seen >= target) {
+                return std::min(BucketUpperBound(i), m_max);
+            }
+        }
+        return m_max;
+    }
+    
+    // Implementarea MetricsSnapshot
+    MetricsSnapshot::MetricsSnapshot()
+        : enabled(Metrics::IsEnabled()), threadCount(0), latency(METRIC_OPERATION_COUNT),
+          operationAllocations(), rejections(), allocations(0), allocatedBytes(0) {
+    }
+    
+    // Contoarele unui fir. Doar firul proprietar le modifica (load + store, fara instructiuni atomice scumpe);
+    // celelalte fire doar le citesc la TakeSnapshot sau le reseteaza
+    struct ThreadMetrics {
+        std::atomic<std::uint64_t> buckets[METRIC_OPERATION_COUNT][LatencyHistogram::BUCKET_COUNT];
+        std::atomic<std::uint64_t> count[METRIC_OPERATION_COUNT];
+        std::atomic<std::uint64_t> sum[METRIC_OPERATION_COUNT];
+        std::atomic<std::uint64_t> min[METRIC_OPERATION_COUNT];
+        std::atomic<std::uint64_t> max[METRIC_OPERATION_COUNT];
+        std::atomic<std::uint64_t> operationAllocations[METRIC_OPERATION_COUNT];
+        std::atomic<std::uint64_t> rejections[REJECTION_REASON_COUNT];
+        std::atomic<std::uint64_t> allocations;
+        std::atomic<std::uint64_t> allocatedBytes;
+        
+        ThreadMetrics() {
+            Clear();
+        }
+        
+        static void Add(std::atomic<std::uint64_t>& counter, std::uint64_t value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+        
+        static std::uint64_t Get(const std::atomic<std::uint64_t>& counter) {
+            return counter.load(std::memory_order_relaxed);
+        }
+        
+        void Record(size_t operation, std::uint64_t nanoseconds, std::uint64_t allocationCount) {
+            Add(buckets[operation][LatencyHistogram::BucketIndex(nanoseconds)], 1);
+            if (Get(count[operation]) == 0 || nanoseconds < Get(min[operation])) {
+                min[operation].store(nanoseconds, std::memory_order_relaxed);
+            }
+            if (nanoseconds > Get(max[operation])) {
+                max[operation].store(nanoseconds, std::memory_order_relaxed);
+            }
+            Add(sum[operation], nanoseconds);
+            Add(count[operation], 1);
+            Add(operationAllocations[operation], allocationCount);
+        }
+        
+        void Clear() {
+            for (size_t op = 0; op < METRIC_OPERATION_COUNT; ++op) {
+                for (auto& bucket : buckets[op]) {
+                    bucket.store(0, std::memory_order_relaxed);
+                }
+                count[op].store(0, std::memory_order_relaxed);
+                sum[op].store(0, std::memory_order_relaxed);
+                min[op].store(0, std::memory_order_relaxed);
+                max[op].store(0, std::memory_order_relaxed);
+                operationAllocations[op].store(0, std::memory_order_relaxed);
+            }
+            for (auto& counter : rejections) {
+                counter.store(0, std::memory_order_relaxed);
+            }
+            allocations.store(0, std::memory_order_relaxed);
+            allocatedBytes.store(0, std::memory_order_relaxed);
+        }
+        
+        // Adauga contoarele acestui fir in alt set (contoarele firelor oprite)
+        void AddTo(ThreadMetrics& target) const {
+            for (size_t op = 0; op < METRIC_OPERATION_COUNT; ++op) {
+                std::uint64_t opCount = Get(count[op]);
+                if (opCount != 0) {
+                    for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; ++i) {
+                        Add(target.buckets[op][i], Get(buckets[op][i]));
+                    }
+                    if (Get(target.count[op]) == 0 || Get(min[op]) < Get(target.min[op])) {
+                        target.min[op].store(Get(min[op]), std::memory_order_relaxed);
+                    }
+                    target.max[op].store(std::max(Get(max[op]), Get(target.max[op])), std::memory_order_relaxed);
+                    Add(target.sum[op], Get(sum[op]));
+                    Add(target.count[op], opCount);
+                }
+                Add(target.operationAllocations[op], Get(operationAllocations[op]));
+            }
+            for (size_t i = 0; i < REJECTION_REASON_COUNT; ++i) {
+                Add(target.rejections[i], Get(rejections[i]));
+            }
+            Add(target.allocations, Get(allocations));
+            Add(target.allocatedBytes, Get(allocatedBytes));
+        }
+        
+        // Adauga contoarele acestui fir in starea agregata
+        void AddTo(MetricsSnapshot& snapshot) const {
+            for (size_t op = 0; op < METRIC_OPERATION_COUNT; ++op) {
+                LatencyHistogram& histogram = snapshot.latency[op];
+                std::uint64_t opCount = 0;
+                for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; ++i) {
+                    std::uint64_t bucket = Get(buckets[op][i]);
+                    histogram.m_buckets[i] += bucket;
+                    opCount += bucket;
+                }
+                // Numaram dupa intervale, ca percentilele sa ramana coerente daca firul inregistreaza in timpul citirii
+                if (opCount != 0) {
+                    histogram.m_min = histogram.m_count == 0 ? Get(min[op]) : std::min(histogram.m_min, Get(min[op]));
+                    histogram.m_max = std::max(histogram.m_max, Get(max[op]));
+                    histogram.m_sum += Get(sum[op]);
+                    histogram.m_count += opCount;
+                }
+                snapshot.operationAllocations[op] += Get(operationAllocations[op]);
+            }
+            for (size_t i = 0; i < REJECTION_REASON_COUNT; ++i) {
+                snapshot.rejections[i] += Get(rejections[i]);
+            }
+            snapshot.allocations += Get(allocations);
+            snapshot.allocatedBytes += Get(allocatedBytes);
+        }
+    };
+    
+    namespace {
+        // Firele inregistrate si contoarele celor oprite. Nu se distruge niciodata, ca sa poata fi folosit
+        // si din destructorii thread_local care ruleaza la iesirea din program
+        struct MetricsRegistry {
+            std::mutex mutex;
+            std::vector<ThreadMetrics*> threads;
+            ThreadMetrics retired;
+            size_t retiredThreads = 0;
+        };
+        
+        MetricsRegistry& GetRegistry() {
+            static MetricsRegistry* registry = new MetricsRegistry();
+            return *registry;
+        }
+        
+        // Alocarile facute inainte ca firul sa aiba contoare proprii (initializate constant, deci utilizabile
+        // din operator new chiar in timpul initializarii statice)
+        std::atomic<std::uint64_t> g_unattributed_allocations{0};
+        std::atomic<std::uint64_t> g_unattributed_bytes{0};
+        
+        // Pointer simplu (fara destructor), citit de operator new fara initializari ascunse
+        thread_local ThreadMetrics* t_metrics = nullptr;
+        
+        // Muta contoarele firului in registru cand firul se opreste
+        struct ThreadMetricsOwner {
+            ThreadMetrics* metrics = nullptr;
+            
+            ~ThreadMetricsOwner() {
+                if (!metrics) {
+                    return;
+                }
+                MetricsRegistry& registry = GetRegistry();
+                {
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    metrics->AddTo(registry.retired);
+                    registry.retiredThreads++;
+                    registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), metrics));
+                }
+                t_metrics = nullptr;
+                delete metrics;
+            }
+        };
+        
+        thread_local ThreadMetricsOwner t_owner;
+        
+        ThreadMetrics& GetThreadMetrics() {
+            if (!t_metrics) {
+                ThreadMetrics* metrics = new ThreadMetrics();
+                MetricsRegistry& registry = GetRegistry();
+                {
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    registry.threads.push_back(metrics);
+                }
+                t_owner.metrics = metrics;
+                t_metrics = metrics;
+            }
+            return *t_metrics;
+        }
+    }
+    
+    // Implementarea Metrics
+    void Metrics::RecordLatency(MetricOperation operation, std::uint64_t nanoseconds, std::uint64_t allocations) {
+        GetThreadMetrics().Record(static_cast<size_t>(operation), nanoseconds, allocations);
+    }
+    
+    void Metrics::RecordRejection(RejectionReason reason) {
+        ThreadMetrics::Add(GetThreadMetrics().rejections[static_cast<size_t>(reason)], 1);
+    }
+    
+    MetricsSnapshot Metrics::TakeSnapshot() {
+        MetricsSnapshot snapshot;
+        MetricsRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.retired.AddTo(snapshot);
+        for (const ThreadMetrics* metrics : registry.threads) {
+            metrics->AddTo(snapshot);
+        }
+        snapshot.threadCount = registry.threads.size() + registry.retiredThreads;
+        snapshot.allocations += g_unattributed_allocations.load(std::memory_order_relaxed);
+        snapshot.allocatedBytes += g_unattributed_bytes.load(std::memory_order_relaxed);
+        return snapshot;
+    }
+    
+    void Metrics::Reset() {
+        MetricsRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.retired.Clear();
+        for (ThreadMetrics* metrics : registry.threads) {
+            metrics->Clear();
+        }
+        g_unattributed_allocations.store(0, std::memory_order_relaxed);
+        g_unattributed_bytes.store(0, std::memory_order_relaxed);
+    }
+    
+    // Implementarea ScopedOperationTimer
+    ScopedOperationTimer::ScopedOperationTimer(MetricOperation operation)
+        : m_operation(operation), m_metrics(&GetThreadMetrics()),
+          m_allocations(ThreadMetrics::Get(m_metrics->allocations)), m_start(std::chrono::steady_clock::now()) {
+    }
+    
+    ScopedOperationTimer::~ScopedOperationTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - m_start;
+        std::uint64_t allocations = ThreadMetrics::Get(m_metrics->allocations);
+        m_metrics->Record(static_cast<size_t>(m_operation),
+                          static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+                          allocations >= m_allocations ? allocations - m_allocations : 0);
+    }
+}
+
+#ifdef SALON_METRICS
+// Numaram alocarile programului inlocuind operator new; fara SALON_METRICS se foloseste cel standard
+namespace {
+    void CountAllocation(std::size_t size) {
+        using Beauty_Salon::ThreadMetrics;
+        if (ThreadMetrics* metrics = Beauty_Salon::t_metrics) {
+            ThreadMetrics::Add(metrics->allocations, 1);
+            ThreadMetrics::Add(metrics->allocatedBytes, size);
+        } else {
+            Beauty_Salon::g_unattributed_allocations.fetch_add(1, std::memory_order_relaxed);
+            Beauty_Salon::g_unattributed_bytes.fetch_add(size, std::memory_order_relaxed);
+        }
+    }
+}
+
+void* operator new(std::size_t size) {
+    CountAllocation(size);
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    CountAllocation(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+#endif
@@ -0,0 +1,180 @@
+#include "overlap_kernel.h"
+#include <algorithm>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SALON_HAS_AVX2_KERNEL 1
+#include <immintrin.h>
+#endif
+
+namespace Beauty_Salon {
+    namespace {
+        // Minutul absolut pe 32 de biti; valorile din afara domeniului sunt saturate, nu trunchiate
+        std::int32_t ToKernelMinute(std::int64_t minute) {
+            return static_cast<std::int32_t>(std::min<std::int64_t>(std::max<std::int64_t>(minute, INT32_MIN), INT32_MAX));
+        }
+    }
+    
+    // Implementarea PackedIntervals
+    void PackedIntervals::Clear() {
+        starts.clear();
+        ends.clear();
+    }
+    
+    void PackedIntervals::Reserve(std::size_t count) {
+        starts.reserve(count);
+        ends.reserve(count);
+    }
+    
+    void PackedIntervals::PushBack(const TimeSlot& slot) {
+        starts.push_back(ToKernelMinute(slot.GetAbsoluteStart()));
+        ends.push_back(ToKernelMinute(slot.GetAbsoluteEnd()));
+    }
+    
+    void PackedIntervals::Set(std::size_t index, const TimeSlot& slot) {
+        starts[index] = ToKernelMinute(slot.GetAbsoluteStart());
+        ends[index] = ToKernelMinute(slot.GetAbsoluteEnd());
+    }
+    
+    void PackedIntervals::Insert(std::size_t index, const TimeSlot& slot) {
+        starts.insert(starts.begin() + index, ToKernelMinute(slot.GetAbsoluteStart()));
+        ends.insert(ends.begin() + index, ToKernelMinute(slot.GetAbsoluteEnd()));
+    }
+    
+    void PackedIntervals::Erase(std::size_t index) {
+        starts.erase(starts.begin() + index);
+        ends.erase(ends.begin() + index);
+    }
+    
+    namespace OverlapKernel {
+        // Varianta scalara - folosita pe procesoare fara AVX2 si pentru coada tablourilor
+        std::size_t CountScalar(std::int32_t queryStart, std::int32_t queryEnd,
+                                const std::int32_t* starts, const std::int32_t* ends, std::size_t count) {
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                total += static_cast<std::size_t>((starts[i] < queryEnd) & (queryStart < ends[i]));
+            }
+            return total;
+        }
+        
+        std::size_t MaskScalar(std::int32_t queryStart, std::int32_t queryEnd,
+                               const std::int32_t* starts, const std::int32_t* ends, std::size_t count,
+                               std::uint64_t* mask) {
+            std::size_t total = 0;
+            for (std::size_t word = 0; word * 64 < count; ++word) {
+                std::uint64_t bits = 0;
+                std::size_t end = (word + 1) * 64 < count ? (word + 1) * 64 : count;
+                for (std::size_t i = word * 64; i < end; ++i) {
+                    std::uint64_t hit = static_cast<std::uint64_t>((starts[i] < queryEnd) & (queryStart < ends[i]));
+                    bits |= hit << (i - word * 64);
+                }
+                mask[word] = bits;
+                total += static_cast<std::size_t>(__builtin_popcountll(bits));
+            }
+            return total;
+        }
+
+#ifdef SALON_HAS_AVX2_KERNEL
+        // Compara 8 intervale deodata si intoarce cate un bit pentru fiecare suprapunere
+        __attribute__((target("avx2")))
+        static inline unsigned _OverlapBits8(__m256i queryStart, __m256i queryEnd,
+                                             const std::int32_t* starts, const std::int32_t* ends) {
+            __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(starts));
+            __m256i e = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ends));
+            // start < queryEnd si queryStart < end
+            __m256i hit = _mm256_and_si256(_mm256_cmpgt_epi32(queryEnd, s), _mm256_cmpgt_epi32(e, queryStart));
+            return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(hit)));
+        }
+        
+        __attribute__((target("avx2")))
+        std::size_t CountAvx2(std::int32_t queryStart, std::int32_t queryEnd,
+                              const std::int32_t* starts, const std::int32_t* ends, std::size_t count) {
+            const __m256i qs = _mm256_set1_epi32(queryStart);
+            const __m256i qe = _mm256_set1_epi32(queryEnd);
+            std::size_t total = 0;
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                total += static_cast<std::size_t>(__builtin_popcount(_OverlapBits8(qs, qe, starts + i, ends + i)));
+            }
+            return total + CountScalar(queryStart, queryEnd, starts + i, ends + i, count - i);
+        }
+        
+        __attribute__((target("avx2")))
+        std::size_t MaskAvx2(std::int32_t queryStart, std::int32_t queryEnd,
+                             const std::int32_t* starts, const std::int32_t* ends, std::size_t count,
+                             std::uint64_t* mask) {
+            const __m256i qs = _mm256_set1_epi32(queryStart);
+            const __m256i qe = _mm256_set1_epi32(queryEnd);
+            std::size_t total = 0;
+            std::size_t word = 0;
+            // Cuvinte complete de 64 de intervale
+            for (; (word + 1) * 64 <= count; ++word) {
+                std::uint64_t bits = 0;
+                const std::size_t base = word * 64;
+                for (std::size_t lane = 0; lane < 64; lane += 8) {
+                    bits |= static_cast<std::uint64_t>(_OverlapBits8(qs, qe, starts + base + lane, ends + base + lane)) << lane;
+                }
+                mask[word] = bits;
+                total += static_cast<std::size_t>(__builtin_popcountll(bits));
+            }
+            // Ultimul cuvant (incomplet) se calculeaza scalar
+            if (word * 64 < count) {
+                total += MaskScalar(queryStart, queryEnd, starts + word * 64, ends + word * 64,
+                                    count - word * 64, mask + word);
+            }
+            return total;
+        }
+        
+        bool HasAvx2() {
+            static const bool supported = __builtin_cpu_supports("avx2");
+            return supported;
+        }
+#else
+        std::size_t CountAvx2(std::int32_t queryStart, std::int32_t queryEnd,
+                              const std::int32_t* starts, const std::int32_t* ends, std::size_t count) {
+            return CountScalar(queryStart, queryEnd, starts, ends, count);
+        }
+        
+        std::size_t MaskAvx2(std::int32_t queryStart, std::int32_t queryEnd,
+                             const std::int32_t* starts, const std::int32_t* ends, std::size_t count,
+                             std::uint64_t* mask) {
+            return MaskScalar(queryStart, queryEnd, starts, ends, count, mask);
+        }
+        
+        bool HasAvx2() {
+            return false;
+        }
+#endif
+        
+        const char* ActiveKernelName() {
+            return HasAvx2() ? "avx2" : "scalar";
+        }
+    }
+    
+    // Selectia variantei se face o singura data, la primul apel
+    std::size_t CountOverlaps(std::int32_t queryStart, std::int32_t queryEnd,
+                              const std::int32_t* starts, const std::int32_t* ends, std::size_t count) {
+        static const auto kernel = OverlapKernel::HasAvx2() ? &OverlapKernel::CountAvx2 : &OverlapKernel::CountScalar;
+        return kernel(queryStart, queryEnd, starts, ends, count);
+    }
+    
+    std::size_t ComputeOverlapMask(std::int32_t queryStart, std::int32_t queryEnd,
+                                   const std::int32_t* starts, const std::int32_t* ends, std::size_t count,
+                                   std::uint64_t* mask) {
+        static const auto kernel = OverlapKernel::HasAvx2() ? &OverlapKernel::MaskAvx2 : &OverlapKernel::MaskScalar;
+        return kernel(queryStart, queryEnd, starts, ends, count, mask);
+    }
+    
+    std::size_t CountOverlaps(const TimeSlot& slot, const PackedIntervals& intervals) {
+        return CountOverlaps(ToKernelMinute(slot.GetAbsoluteStart()),
+                             ToKernelMinute(slot.GetAbsoluteEnd()),
+                             intervals.starts.data(), intervals.ends.data(), intervals.Size());
+    }
+    
+    std::size_t ComputeOverlapMask(const TimeSlot& slot, const PackedIntervals& intervals, std::vector<std::uint64_t>& mask) {
+        mask.resize((intervals.Size() + 63) / 64);
+        return ComputeOverlapMask(ToKernelMinute(slot.GetAbsoluteStart()),
+                                  ToKernelMinute(slot.GetAbsoluteEnd()),
+                                  intervals.starts.data(), intervals.ends.data(), intervals.Size(),
+                                  mask.data());
+    }
+}
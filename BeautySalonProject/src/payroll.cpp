@@ -0,0 +1,147 @@
+#include "payroll.h"
+#include <algorithm>
+#include <unordered_map>
+
+namespace Beauty_Salon {
+    namespace {
+        // Angajatii calculati de o sarcina; sub acest numar, costul sarcinii depaseste castigul
+        constexpr size_t EMPLOYEES_PER_TASK = 16;
+    }
+    
+    // Implementarea CommissionRule
+    CommissionRule::CommissionRule() 
+        : name(""), serviceTypes(0), role(""), percent(0.0), minPeriodRevenue(0.0) {
+    }
+    
+    CommissionRule::CommissionRule(const std::string& ruleName, ServiceTypeMask types, double rulePercent) 
+        : name(ruleName), serviceTypes(types), role(""), percent(rulePercent), minPeriodRevenue(0.0) {
+    }
+    
+    // Implementarea PayrollEngine
+    PayrollEngine::PayrollEngine() : m_task_pool(nullptr) {
+    }
+    
+    void PayrollEngine::AddCommissionRule(const CommissionRule& rule) {
+        m_rules.push_back(rule);
+    }
+    
+    const std::vector<CommissionRule>& PayrollEngine::GetCommissionRules() const {
+        return m_rules;
+    }
+    
+    void PayrollEngine::ClearCommissionRules() {
+        m_rules.clear();
+    }
+    
+    TaskPool* PayrollEngine::GetTaskPool() const {
+        return m_task_pool;
+    }
+    
+    void PayrollEngine::SetTaskPool(TaskPool* pool) {
+        m_task_pool = pool;
+    }
+    
+    PayrollEntry PayrollEngine::_ComputeEntry(const Employee& employee, 
+                                              const std::vector<const Appointment*>& appointments) const {
+        PayrollEntry entry;
+        entry.employeeId = employee.GetID();
+        entry.employeeName = employee.GetName();
+        
+        double revenueByType[SERVICE_TYPE_COUNT] = {};
+        for (const Appointment* app : appointments) {
+            entry.completedAppointments++;
+            entry.workedMinutes += app->GetTimeSlot().GetDuration();
+            entry.revenue += app->GetTotalPrice();
+            if (app->GetService()) {
+                revenueByType[static_cast<int>(app->GetService()->GetType())] += app->GetTotalPrice();
+            }
+        }
+        
+        entry.hourlyPay = entry.workedMinutes / 60.0 * employee.GetHourlyRate();
+        
+        const std::string role = employee.GetRole();
+        for (const auto& rule : m_rules) {
+            if ((!rule.role.empty() && rule.role != role) || entry.revenue < rule.minPeriodRevenue) {
+                continue;
+            }
+            double base = 0.0;
+            for (int type = 0; type < SERVICE_TYPE_COUNT; ++type) {
+                if (rule.serviceTypes & ServiceTypeBit(static_cast<ServiceType>(type))) {
+                    base += revenueByType[type];
+                }
+            }
+            entry.commission += base * rule.percent / 100.0;
+        }
+        
+        entry.totalPay = entry.hourlyPay + entry.commission;
+        return entry;
+    }
+    
+    PayrollReport PayrollEngine::Compute(const std::vector<Appointment>& appointments, 
+                                         const std::vector<const Employee*>& employees, 
+                                         int firstDay, int lastDay) const {
+        PayrollReport report;
+        report.firstDay = firstDay;
+        report.lastDay = lastDay;
+        
+        // O singura trecere prin programari: le grupam pe angajati, in ordinea in care apar
+        std::unordered_map<const Employee*, size_t> indexOf;
+        indexOf.reserve(employees.size());
+        for (size_t i = 0; i < employees.size(); ++i) {
+            indexOf.emplace(employees[i], i);
+        }
+        
+        std::vector<std::vector<const Appointment*>> byEmployee(employees.size());
+        for (const auto& app : appointments) {
+            int day = app.GetTimeSlot().GetDay();
+            if (app.GetStatus() != AppointmentStatus::COMPLETED || day < firstDay || day > lastDay) {
+                continue;
+            }
+            auto it = indexOf.find(app.GetEmployee());
+            if (it != indexOf.end()) {
+                byEmployee[it->second].push_back(&app);
+            }
+        }
+        
+        // Fiecare sarcina calculeaza un bloc contiguu de angajati si scrie doar in liniile sale
+        report.entries.resize(employees.size());
+        TaskPool& pool = m_task_pool ? *m_task_pool : TaskPool::GetDefault();
+        pool.ParallelFor(0, employees.size(), EMPLOYEES_PER_TASK, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                report.entries[i] = _ComputeEntry(*employees[i], byEmployee[i]);
+            }
+        });
+        
+        // Reducerea se face in ordinea angajatilor, independent de numarul de fire
+        for (const auto& entry : report.entries) {
+            report.totalHourlyPay += entry.hourlyPay;
+            report.totalCommission += entry.commission;
+            report.totalPay += entry.totalPay;
+        }
+        return report;
+    }
+    
+    std::vector<CommissionRule> CreateStandardCommissionRules() {
+        std::vector<CommissionRule> rules;
+        
+        // Comision de baza pentru toate serviciile
+        rules.push_back(CommissionRule("Base", ServiceTypesMask({ServiceType::HAIR_CUT, ServiceType::HAIR_COLOR, 
+                                                                 ServiceType::MANICURE, ServiceType::PEDICURE,
+                                                                 ServiceType::FACIAL, ServiceType::MASSAGE, 
+                                                                 ServiceType::OTHER}), 5.0));
+        
+        // Vopsitul aduce un comision suplimentar stilistilor
+        CommissionRule coloring("Coloring", ServiceTypeBit(ServiceType::HAIR_COLOR), 5.0);
+        coloring.role = "Stylist";
+        rules.push_back(coloring);
+        
+        // Bonus pentru venit mare pe perioada
+        CommissionRule highRevenue("High Revenue", ServiceTypesMask({ServiceType::HAIR_CUT, ServiceType::HAIR_COLOR, 
+                                                                     ServiceType::MANICURE, ServiceType::PEDICURE,
+                                                                     ServiceType::FACIAL, ServiceType::MASSAGE, 
+                                                                     ServiceType::OTHER}), 3.0);
+        highRevenue.minPeriodRevenue = 5000.0;
+        rules.push_back(highRevenue);
+        return rules;
+    }
+}
@@ -0,0 +1,57 @@
+#include "pricing.h"
+#include <atomic>
+
+namespace Beauty_Salon {
+    // Implementarea PriceRecord
+    PriceRecord::PriceRecord() 
+        : basePrice(0.0), multiplier(1.0), surcharge(0.0), price(0.0), 
+          duration(0), type(ServiceType::OTHER) {
+    }
+    
+    PriceRecord::PriceRecord(double base, double mult, double extra, int dur, ServiceType serviceType) 
+        : basePrice(base), multiplier(mult), surcharge(extra), price(base * mult + extra), 
+          duration(dur), type(serviceType) {
+    }
+    
+    namespace {
+        std::atomic<std::uint64_t> g_price_epoch(1);
+    }
+    
+    // Implementarea PriceEpoch
+    std::uint64_t PriceEpoch::Get() {
+        return g_price_epoch.load(std::memory_order_acquire);
+    }
+    
+    void PriceEpoch::Advance() {
+        g_price_epoch.fetch_add(1, std::memory_order_acq_rel);
+    }
+    
+    // Implementarea PricingEngine
+    double PricingEngine::QuoteBatch(const PriceQuoteLine* lines, std::size_t count, double* prices) {
+        double total = 0.0;
+        for (std::size_t i = 0; i < count; ++i) {
+            double price = Quote(*lines[i].record, lines[i].discountRate);
+            if (prices) {
+                prices[i] = price;
+            }
+            total += price;
+        }
+        return total;
+    }
+    
+    double PricingEngine::QuotePackage(const PriceRecord* const* records, std::size_t count, double packageDiscount) {
+        double total = 0.0;
+        for (std::size_t i = 0; i < count; ++i) {
+            total += records[i]->price;
+        }
+        return total * (1.0 - packageDiscount / 100.0);
+    }
+    
+    int PricingEngine::TotalDuration(const PriceRecord* const* records, std::size_t count) {
+        int total = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            total += records[i]->duration;
+        }
+        return total;
+    }
+}
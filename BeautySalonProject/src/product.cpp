@@ -1,6 +1,8 @@
 #include "product.h"
+#include "metrics.h"
 #include <iostream>
 #include <algorithm>
+#include <climits>
 
 namespace Beauty_Salon {
     // Initializarea membrului static
@@ -10,23 +12,49 @@ namespace Beauty_Salon {
         return m_next_id++;
     }
     
+    void Product::_Touch() {
+        m_version++;
+        PriceEpoch::Advance();
+    }
+    
     // Implementarea constructorilor
     Product::Product() 
         : m_id(GenerateID()), m_name("Unknown"), m_brand(""), m_price(0.0), 
           m_quantity(0), m_category(ProductCategory::OTHER), 
-          m_description(""), m_is_on_sale(false) {
+          m_description(""), m_is_on_sale(false), m_version(0) {
     }
     
     Product::Product(const std::string& name, double price) 
         : m_id(GenerateID()), m_name(name), m_brand(""), m_price(price), 
           m_quantity(0), m_category(ProductCategory::OTHER), 
-          m_description(""), m_is_on_sale(false) {
+          m_description(""), m_is_on_sale(false), m_version(0) {
     }
     
     Product::Product(const std::string& name, const std::string& brand, double price, ProductCategory category) 
         : m_id(GenerateID()), m_name(name), m_brand(brand), m_price(price), 
           m_quantity(0), m_category(category), 
-          m_description(""), m_is_on_sale(false) {
+          m_description(""), m_is_on_sale(false), m_version(0) {
+    }
+    
+    Product::Product(const Product& other) 
+        : IDiscountable(other), m_id(other.m_id), m_name(other.m_name), m_brand(other.m_brand), 
+          m_price(other.m_price), m_quantity(other.GetQuantity()), m_category(other.m_category), 
+          m_description(other.m_description), m_is_on_sale(other.m_is_on_sale), m_version(other.m_version) {
+    }
+    
+    Product& Product::operator=(const Product& other) {
+        if (this != &other) {
+            m_id = other.m_id;
+            m_name = other.m_name;
+            m_brand = other.m_brand;
+            m_price = other.m_price;
+            m_quantity.store(other.GetQuantity(), std::memory_order_relaxed);
+            m_category = other.m_category;
+            m_description = other.m_description;
+            m_is_on_sale = other.m_is_on_sale;
+            _Touch();
+        }
+        return *this;
     }
     
     Product::~Product() {
@@ -37,7 +65,7 @@ namespace Beauty_Salon {
         return m_id;
     }
     
-    std::string Product::GetName() const {
+    const std::string& Product::GetName() const {
         return m_name;
     }
     
@@ -50,7 +78,7 @@ namespace Beauty_Salon {
     }
     
     int Product::GetQuantity() const {
-        return m_quantity;
+        return m_quantity.load(std::memory_order_relaxed);
     }
     
     ProductCategory Product::GetCategory() const {
@@ -77,12 +105,13 @@ namespace Beauty_Salon {
     void Product::SetPrice(double price) {
         if (price >= 0.0) {
             m_price = price;
+            _Touch();
         }
     }
     
     void Product::SetQuantity(int quantity) {
         if (quantity >= 0) {
-            m_quantity = quantity;
+            m_quantity.store(quantity, std::memory_order_relaxed);
         }
     }
     
@@ -96,22 +125,38 @@ namespace Beauty_Salon {
     
     void Product::SetOnSale(bool onSale) {
         m_is_on_sale = onSale;
+        _Touch();
     }
     
     // Metode pentru gestionarea stocului
     bool Product::UpdateStock(int quantity) {
-        // Verificam daca putem actualiza stocul
-        int newQuantity = m_quantity + quantity;
-        if (newQuantity < 0) {
-            return false;
-        }
+        return UpdateStock(quantity, 0);
+    }
+    
+    bool Product::UpdateStock(int quantity, int minimum) {
+        SALON_MEASURE(PRODUCT_UPDATE_STOCK);
+        
+        // Verificarea si scrierea se fac atomic: daca alt fir a modificat stocul intre timp,
+        // compare_exchange esueaza, reincarca valoarea curenta si reluam verificarea
+        int current = m_quantity.load(std::memory_order_relaxed);
+        int newQuantity;
+        do {
+            // Refuzam si depasirea lui INT_MAX la reaprovizionare
+            if (quantity > 0 && current > INT_MAX - quantity) {
+                return false;
+            }
+            newQuantity = current + quantity;
+            if (newQuantity < 0 || (quantity < 0 && newQuantity < minimum)) {
+                SALON_COUNT_REJECTION(INSUFFICIENT_STOCK);
+                return false;
+            }
+        } while (!m_quantity.compare_exchange_weak(current, newQuantity, std::memory_order_relaxed));
         
-        m_quantity = newQuantity;
         return true;
     }
     
     bool Product::IsInStock() const {
-        return m_quantity > 0;
+        return GetQuantity() > 0;
     }
     
     // Implementarea metodei din interfata IDiscountable
@@ -121,28 +166,32 @@ namespace Beauty_Salon {
     }
     
     // Metode virtuale
+    double Product::CalculateListPrice() const {
+        return m_price;
+    }
+    
     double Product::CalculateFinalPrice() const {
         double price = m_price;
         
         // Daca produsul este la reducere, aplicam un discount de 15%
         if (m_is_on_sale) {
-            price *= 0.85; 
+            price *= (1.0 - PRODUCT_SALE_DISCOUNT / 100.0); 
         }
         
         return price;
     }
     
     void Product::DisplayInfo() const {
-        std::cout << "Product ID: " << m_id << std::endl;
-        std::cout << "Name: " << m_name << std::endl;
+        std::cout << "Product ID: " << m_id << "\n";
+        std::cout << "Name: " << m_name << "\n";
         if (!m_brand.empty()) {
-            std::cout << "Brand: " << m_brand << std::endl;
+            std::cout << "Brand: " << m_brand << "\n";
         }
         std::cout << "Price: $" << m_price;
         if (m_is_on_sale) {
             std::cout << " (Sale: $" << CalculateFinalPrice() << ")";
         }
-        std::cout << std::endl;
+        std::cout << "\n";
         
         std::cout << "Category: ";
         switch (m_category) {
@@ -153,28 +202,42 @@ namespace Beauty_Salon {
             case ProductCategory::ACCESSORIES: std::cout << "Accessories"; break;
             default: std::cout << "Other"; break;
         }
-        std::cout << std::endl;
+        std::cout << "\n";
         
-        std::cout << "Quantity in Stock: " << m_quantity << std::endl;
+        std::cout << "Quantity in Stock: " << GetQuantity() << "\n";
         
         if (!m_description.empty()) {
-            std::cout << "Description: " << m_description << std::endl;
+            std::cout << "Description: " << m_description << "\n";
         }
     }
     
-    // Supraincarcarea operatorului <<
-    std::ostream& operator<<(std::ostream& os, const Product& product) {
-        os << "Product: " << product.m_name;
-        if (!product.m_brand.empty()) {
-            os << " (" << product.m_brand << ")";
+    void Product::FormatTo(TextBuffer& out) const {
+        out.Append("Product: ").Append(m_name);
+        if (!m_brand.empty()) {
+            out.Append(" (").Append(m_brand).Append(')');
         }
-        os << " - $" << product.m_price;
-        if (product.m_is_on_sale) {
-            os << " (Sale: $" << product.CalculateFinalPrice() << ")";
+        out.Append(" - $").AppendPrice(m_price);
+        if (m_is_on_sale) {
+            out.Append(" (Sale: $").AppendPrice(CalculateFinalPrice()).Append(')');
         }
+    }
+    
+    // Supraincarcarea operatorului <<
+    std::ostream& operator<<(std::ostream& os, const Product& product) {
+        TextBuffer buffer;
+        product.FormatTo(buffer);
+        buffer.WriteTo(os);
         return os;
     }
     
+    void RenderProductList(TextBuffer& out, const std::vector<std::unique_ptr<Product>>& products) {
+        for (size_t i = 0; i < products.size(); ++i) {
+            out.AppendInteger(static_cast<long long>(i + 1)).Append(". ");
+            products[i]->FormatTo(out);
+            out.Append('\n');
+        }
+    }
+    
     // Implementari RetailProduct
     RetailProduct::RetailProduct() 
         : Product(), m_retail_markup(0.3), m_is_tester_available(false) {
@@ -200,6 +263,7 @@ namespace Beauty_Salon {
     void RetailProduct::SetRetailMarkup(double markup) {
         if (markup >= 0.0) {
             m_retail_markup = markup;
+            _Touch();
         }
     }
     
@@ -207,6 +271,11 @@ namespace Beauty_Salon {
         m_is_tester_available = available;
     }
     
+    double RetailProduct::CalculateListPrice() const {
+        // Pretul de baza cu adaosul de retail
+        return GetPrice() * (1.0 + m_retail_markup);
+    }
+    
     double RetailProduct::CalculateFinalPrice() const {
         // Calculam pretul de baza
         double basePrice = Product::CalculateFinalPrice();
@@ -217,9 +286,9 @@ namespace Beauty_Salon {
     
     void RetailProduct::DisplayInfo() const {
         Product::DisplayInfo();
-        std::cout << "Retail Markup: " << (m_retail_markup * 100.0) << "%" << std::endl;
-        std::cout << "Tester Available: " << (m_is_tester_available ? "Yes" : "No") << std::endl;
-        std::cout << "Final Retail Price: $" << CalculateFinalPrice() << std::endl;
+        std::cout << "Retail Markup: " << (m_retail_markup * 100.0) << "%\n";
+        std::cout << "Tester Available: " << (m_is_tester_available ? "Yes" : "No") << "\n";
+        std::cout << "Final Retail Price: $" << CalculateFinalPrice() << "\n";
     }
     
     // Implementari ProfessionalProduct
@@ -260,6 +329,7 @@ namespace Beauty_Salon {
     
     void ProfessionalProduct::SetRequiresCertification(bool requires) {
         m_requires_certification = requires;
+        _Touch();
     }
     
     // Metode pentru gestionarea utilizarii
@@ -267,9 +337,20 @@ namespace Beauty_Salon {
         m_usage_count++;
     }
     
+    void ProfessionalProduct::AddUsage(int uses) {
+        if (uses > 0) {
+            m_usage_count += uses;
+        }
+    }
+    
     bool ProfessionalProduct::NeedsReplacement() const {
-        // Presupunem ca un produs profesional trebuie inlocuit după 500 de utilizari
-        return m_usage_count >= 500;
+        // Presupunem ca un produs profesional trebuie inlocuit după USES_PER_UNIT (500) de utilizari
+        return m_usage_count >= USES_PER_UNIT;
+    }
+    
+    double ProfessionalProduct::CalculateListPrice() const {
+        // Produsele care necesita certificare sunt mai scumpe
+        return m_requires_certification ? GetPrice() * 1.25 : GetPrice();
     }
     
     double ProfessionalProduct::CalculateFinalPrice() const {
@@ -286,10 +367,10 @@ namespace Beauty_Salon {
     
     void ProfessionalProduct::DisplayInfo() const {
         Product::DisplayInfo();
-        std::cout << "Supplier: " << (m_supplier.empty() ? "Unknown" : m_supplier) << std::endl;
-        std::cout << "Usage Count: " << m_usage_count << std::endl;
-        std::cout << "Requires Certification: " << (m_requires_certification ? "Yes" : "No") << std::endl;
-        std::cout << "Replacement Status: " << (NeedsReplacement() ? "Needs Replacement" : "OK") << std::endl;
+        std::cout << "Supplier: " << (m_supplier.empty() ? "Unknown" : m_supplier) << "\n";
+        std::cout << "Usage Count: " << m_usage_count << "\n";
+        std::cout << "Requires Certification: " << (m_requires_certification ? "Yes" : "No") << "\n";
+        std::cout << "Replacement Status: " << (NeedsReplacement() ? "Needs Replacement" : "OK") << "\n";
     }
     
     // Implementari ProductBundle
@@ -309,48 +390,93 @@ namespace Beauty_Salon {
         // Nu eliberam resursele aici deoarece nu detinem produsele
     }
     
-    void ProductBundle::AddProduct(Product* product) {
+    void ProductBundle::AddProduct(const Product* product) {
         if (product) {
-            m_products.push_back(product);
+            m_products.PushBack(product);
+            m_totals.Invalidate();
         }
     }
     
+    size_t ProductBundle::GetProductCount() const {
+        return m_products.Size();
+    }
+    
+    const Product* ProductBundle::GetProduct(size_t index) const {
+        return index < m_products.Size() ? m_products[index] : nullptr;
+    }
+    
+    const std::string& ProductBundle::GetName() const {
+        return m_name;
+    }
+    
+    double ProductBundle::GetBundleDiscount() const {
+        return m_bundle_discount;
+    }
+    
+    ProductBundle& ProductBundle::operator+=(const Product& product) {
+        AddProduct(&product);
+        return *this;
+    }
+    
     double ProductBundle::CalculateTotalPrice() const {
+        auto version = [this](size_t i) { return m_products[i]->GetVersion(); };
+        if (m_totals.IsValid(m_products.Size(), version)) {
+            return m_totals.GetPrice();
+        }
+        
         double total = 0.0;
         for (const auto& product : m_products) {
             total += product->CalculateFinalPrice();
         }
         // Aplicam discount-ul pachetului
-        return total * (1.0 - m_bundle_discount / 100.0);
+        total *= (1.0 - m_bundle_discount / 100.0);
+        m_totals.Store(total, 0, m_products.Size(), version);
+        return total;
     }
     
-    void ProductBundle::DisplayBundleInfo() const {
-        std::cout << "Bundle: " << m_name << std::endl;
-        std::cout << "Discount: " << m_bundle_discount << "%" << std::endl;
-        std::cout << "Products included:" << std::endl;
-        
+    BundleReport ProductBundle::BuildReport() const {
+        BundleReport report;
+        report.name = m_name;
+        report.discount = m_bundle_discount;
         for (const auto& product : m_products) {
-            std::cout << " - " << product->GetName() 
-                     << " ($" << product->CalculateFinalPrice() << ")" << std::endl;
+            PackageItem item;
+            item.name = product->GetName();
+            item.price = product->CalculateFinalPrice();
+            report.items.push_back(item);
         }
-        
-        std::cout << "Total Price: $" << CalculateTotalPrice() << std::endl;
+        report.totalPrice = CalculateTotalPrice();
+        return report;
+    }
+    
+    void ProductBundle::DisplayBundleInfo() const {
+        ReportWriter writer(ReportFormat::TEXT);
+        writer.Write(BuildReport());
+        writer.FlushTo(std::cout);
     }
     
     std::ostream& operator<<(std::ostream& os, const ProductBundle& bundle) {
         os << "Bundle: " << bundle.m_name << " - $" << bundle.CalculateTotalPrice() 
-           << " (" << bundle.m_products.size() << " products)";
+           << " (" << bundle.m_products.Size() << " products)";
         return os;
     }
     
     // Operatorul + pentru produse
     ProductBundle operator+(const Product& lhs, const Product& rhs) {
         ProductBundle bundle("Custom Bundle");
-        // Hack temporar: copiem produsele pentru a le adauga în pachet
-        Product* lhsCopy = const_cast<Product*>(&lhs);
-        Product* rhsCopy = const_cast<Product*>(&rhs);
-        bundle.AddProduct(lhsCopy);
-        bundle.AddProduct(rhsCopy);
+        bundle.AddProduct(&lhs);
+        bundle.AddProduct(&rhs);
         return bundle;
     }
+    
+    ProductBundle operator+(ProductBundle&& bundle, const Product& product) {
+        // Pachetul temporar din stanga este refolosit, nu copiat
+        bundle += product;
+        return std::move(bundle);
+    }
+    
+    ProductBundle operator+(const ProductBundle& bundle, const Product& product) {
+        ProductBundle result(bundle);
+        result += product;
+        return result;
+    }
 }
@@ -0,0 +1,146 @@
+#include "qualification_matrix.h"
+
+namespace Beauty_Salon {
+    namespace {
+        constexpr size_t BITS_PER_WORD = 64;
+        
+        // Masca tipurilor valide (bitii peste SERVICE_TYPE_COUNT sunt ignorati)
+        constexpr ServiceTypeMask ALL_TYPES_MASK = (ServiceTypeMask(1) << SERVICE_TYPE_COUNT) - 1;
+    }
+    
+    QualificationMatrix::QualificationMatrix() : m_word_count(0) {
+    }
+    
+    void QualificationMatrix::_SetColumn(size_t column, ServiceTypeMask specializations) {
+        size_t word = column / BITS_PER_WORD;
+        std::uint64_t bit = std::uint64_t(1) << (column % BITS_PER_WORD);
+        for (int type = 0; type < SERVICE_TYPE_COUNT; ++type) {
+            if (specializations & ServiceTypeBit(static_cast<ServiceType>(type))) {
+                m_rows[type][word] |= bit;
+            } else {
+                m_rows[type][word] &= ~bit;
+            }
+        }
+    }
+    
+    void QualificationMatrix::Build(const std::vector<std::unique_ptr<Employee>>& employees) {
+        std::vector<Employee*> raw;
+        raw.reserve(employees.size());
+        for (const auto& employee : employees) {
+            raw.push_back(employee.get());
+        }
+        Build(raw);
+    }
+    
+    void QualificationMatrix::Build(const std::vector<Employee*>& employees) {
+        m_employees.clear();
+        m_word_count = (employees.size() + BITS_PER_WORD - 1) / BITS_PER_WORD;
+        for (auto& row : m_rows) {
+            row.assign(m_word_count, 0);
+        }
+        for (Employee* employee : employees) {
+            if (employee) {
+                AddEmployee(employee);
+            }
+        }
+    }
+    
+    void QualificationMatrix::AddEmployee(Employee* employee) {
+        if (!employee) {
+            return;
+        }
+        
+        size_t column = m_employees.size();
+        if (column / BITS_PER_WORD >= m_word_count) {
+            m_word_count++;
+            for (auto& row : m_rows) {
+                row.resize(m_word_count, 0);
+            }
+        }
+        m_employees.push_back(employee);
+        _SetColumn(column, employee->GetSpecializations());
+    }
+    
+    bool QualificationMatrix::Refresh(const Employee* employee) {
+        for (size_t column = 0; column < m_employees.size(); ++column) {
+            if (m_employees[column] == employee) {
+                _SetColumn(column, employee->GetSpecializations());
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    size_t QualificationMatrix::GetEmployeeCount() const {
+        return m_employees.size();
+    }
+    
+    size_t QualificationMatrix::GetWordCount() const {
+        return m_word_count;
+    }
+    
+    Employee* QualificationMatrix::GetEmployee(size_t column) const {
+        return column < m_employees.size() ? m_employees[column] : nullptr;
+    }
+    
+    const std::uint64_t* QualificationMatrix::GetRow(ServiceType type) const {
+        return m_rows[static_cast<int>(type)].data();
+    }
+    
+    size_t QualificationMatrix::Match(ServiceTypeMask types, std::vector<std::uint64_t>& result) const {
+        types &= ALL_TYPES_MASK;
+        result.assign(m_word_count, 0);
+        if (m_word_count == 0) {
+            return 0;
+        }
+        
+        // Fara tipuri cerute, toti angajatii sunt potriviti
+        for (size_t w = 0; w < m_word_count; ++w) {
+            result[w] = ~std::uint64_t(0);
+        }
+        size_t tail = m_employees.size() % BITS_PER_WORD;
+        if (tail != 0) {
+            result[m_word_count - 1] = (std::uint64_t(1) << tail) - 1;
+        }
+        
+        // Un AND pe cuvant pentru fiecare tip cerut
+        while (types) {
+            int type = __builtin_ctz(types);
+            types &= types - 1;
+            const std::uint64_t* row = m_rows[type].data();
+            for (size_t w = 0; w < m_word_count; ++w) {
+                result[w] &= row[w];
+            }
+        }
+        
+        size_t count = 0;
+        for (size_t w = 0; w < m_word_count; ++w) {
+            count += static_cast<size_t>(__builtin_popcountll(result[w]));
+        }
+        return count;
+    }
+    
+    size_t QualificationMatrix::CountQualified(ServiceTypeMask types) const {
+        std::vector<std::uint64_t> result;
+        return Match(types, result);
+    }
+    
+    std::vector<Employee*> QualificationMatrix::FindQualified(ServiceTypeMask types) const {
+        std::vector<Employee*> result;
+        FindQualified(types, result);
+        return result;
+    }
+    
+    void QualificationMatrix::FindQualified(ServiceTypeMask types, std::vector<Employee*>& result) const {
+        result.clear();
+        std::vector<std::uint64_t> bits;
+        result.reserve(Match(types, bits));
+        for (size_t w = 0; w < bits.size(); ++w) {
+            std::uint64_t word = bits[w];
+            while (word) {
+                result.push_back(m_employees[w * BITS_PER_WORD + static_cast<size_t>(__builtin_ctzll(word))]);
+                word &= word - 1;
+            }
+        }
+    }
+}
@@ -0,0 +1,526 @@
+#include "report.h"
+
+namespace Beauty_Salon {
+    // Implementarea StatusBreakdown
+    void StatusBreakdown::Add(AppointmentStatus status) {
+        switch (status) {
+            case AppointmentStatus::SCHEDULED: scheduled++; break;
+            case AppointmentStatus::IN_PROGRESS: inProgress++; break;
+            case AppointmentStatus::COMPLETED: completed++; break;
+            case AppointmentStatus::CANCELLED: cancelled++; break;
+            case AppointmentStatus::NO_SHOW: noShow++; break;
+        }
+    }
+    
+    const char* GetStatusName(AppointmentStatus status) {
+        switch (status) {
+            case AppointmentStatus::SCHEDULED: return "Scheduled";
+            case AppointmentStatus::IN_PROGRESS: return "In Progress";
+            case AppointmentStatus::COMPLETED: return "Completed";
+            case AppointmentStatus::CANCELLED: return "Cancelled";
+            case AppointmentStatus::NO_SHOW: return "No Show";
+        }
+        return "Unknown";
+    }
+    
+    const char* GetStatusCode(AppointmentStatus status) {
+        switch (status) {
+            case AppointmentStatus::SCHEDULED: return "SCH";
+            case AppointmentStatus::IN_PROGRESS: return "INP";
+            case AppointmentStatus::COMPLETED: return "COM";
+            case AppointmentStatus::CANCELLED: return "CAN";
+            case AppointmentStatus::NO_SHOW: return "NOS";
+        }
+        return "UNK";
+    }
+    
+    // Implementarea ReportWriter
+    ReportWriter::ReportWriter() : m_format(ReportFormat::TEXT) {
+    }
+    
+    ReportWriter::ReportWriter(ReportFormat format) : m_format(format) {
+    }
+    
+    ReportFormat ReportWriter::GetFormat() const {
+        return m_format;
+    }
+    
+    void ReportWriter::SetFormat(ReportFormat format) {
+        m_format = format;
+    }
+    
+    const TextBuffer& ReportWriter::GetBuffer() const {
+        return m_buffer;
+    }
+    
+    void ReportWriter::Clear() {
+        m_buffer.Clear();
+    }
+    
+    void ReportWriter::FlushTo(std::ostream& os) {
+        m_buffer.WriteTo(os);
+        m_buffer.Clear();
+    }
+    
+    void ReportWriter::_AppendString(const std::string& value) {
+        if (m_format == ReportFormat::JSON) {
+            m_buffer.Append('"');
+            for (char c : value) {
+                switch (c) {
+                    case '"': m_buffer.Append("\\\"", 2); break;
+                    case '\\': m_buffer.Append("\\\\", 2); break;
+                    case '\n': m_buffer.Append("\\n", 2); break;
+                    case '\r': m_buffer.Append("\\r", 2); break;
+                    case '\t': m_buffer.Append("\\t", 2); break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            static const char hex[] = "0123456789abcdef";
+                            char escaped[6] = {'\\', 'u', '0', '0', hex[(c >> 4) & 0xF], hex[c & 0xF]};
+                            m_buffer.Append(escaped, 6);
+                        } else {
+                            m_buffer.Append(c);
+                        }
+                        break;
+                }
+            }
+            m_buffer.Append('"');
+            return;
+        }
+        
+        if (m_format == ReportFormat::CSV && value.find_first_of(",\"\n\r") != std::string::npos) {
+            // Campurile cu separatori se pun intre ghilimele, cu ghilimelele dublate
+            m_buffer.Append('"');
+            for (char c : value) {
+                if (c == '"') {
+                    m_buffer.Append('"');
+                }
+                m_buffer.Append(c);
+            }
+            m_buffer.Append('"');
+            return;
+        }
+        
+        m_buffer.Append(value);
+    }
+    
+    void ReportWriter::_AppendJsonKey(const char* key, bool first) {
+        if (!first) {
+            m_buffer.Append(',');
+        }
+        m_buffer.Append('"').Append(key).Append("\":", 2);
+    }
+    
+    void ReportWriter::Write(const DailyReport& report) {
+        if (m_format == ReportFormat::TEXT) {
+            m_buffer.Append("=== Daily Report for Hour ").AppendInteger(report.date).Append(" ===\n");
+            m_buffer.Append("Total Appointments: ").AppendInteger(report.totalAppointments).Append('\n');
+            m_buffer.Append("Total Revenue: $").AppendPrice(report.totalRevenue).Append('\n');
+            m_buffer.Append("Services breakdown:\n");
+            for (const auto& pair : report.services) {
+                m_buffer.Append(" - ").Append(pair.first).Append(": ").AppendInteger(pair.second).Append('\n');
+            }
+            m_buffer.Append("Status breakdown:\n");
+            m_buffer.Append(" - Scheduled: ").AppendInteger(report.status.scheduled).Append('\n');
+            m_buffer.Append(" - In Progress: ").AppendInteger(report.status.inProgress).Append('\n');
+            m_buffer.Append(" - Completed: ").AppendInteger(report.status.completed).Append('\n');
+            m_buffer.Append(" - Cancelled: ").AppendInteger(report.status.cancelled).Append('\n');
+            m_buffer.Append(" - No Show: ").AppendInteger(report.status.noShow).Append('\n');
+        } else if (m_format == ReportFormat::JSON) {
+            m_buffer.Append('{');
+            _AppendJsonKey("date", true);
+            m_buffer.AppendInteger(report.date);
+            _AppendJsonKey("total_appointments", false);
+            m_buffer.AppendInteger(report.totalAppointments);
+            _AppendJsonKey("total_revenue", false);
+            m_buffer.AppendPrice(report.totalRevenue);
+            _AppendJsonKey("services", false);
+            m_buffer.Append('{');
+            for (size_t i = 0; i < report.services.size(); ++i) {
+                if (i > 0) {
+                    m_buffer.Append(',');
+                }
+                _AppendString(report.services[i].first);
+                m_buffer.Append(':').AppendInteger(report.services[i].second);
+            }
+            m_buffer.Append('}');
+            _AppendJsonKey("status", false);
+            m_buffer.Append("{\"scheduled\":").AppendInteger(report.status.scheduled)
+                    .Append(",\"in_progress\":").AppendInteger(report.status.inProgress)
+                    .Append(",\"completed\":").AppendInteger(report.status.completed)
+                    .Append(",\"cancelled\":").AppendInteger(report.status.cancelled)
+                    .Append(",\"no_show\":").AppendInteger(report.status.noShow)
+                    .Append("}}\n");
+        } else {
+            // CSV in format lung: o linie pentru fiecare metrica
+            const auto row = [this, &report](const char* metric, const std::string& name, double value) {
+                m_buffer.AppendInteger(report.date).Append(',').Append(metric).Append(',');
+                _AppendString(name);
+                m_buffer.Append(',').AppendPrice(value).Append('\n');
+            };
+            static const std::string empty;
+            m_buffer.Append("date,metric,name,value\n");
+            row("total_appointments", empty, report.totalAppointments);
+            row("total_revenue", empty, report.totalRevenue);
+            for (const auto& pair : report.services) {
+                row("service", pair.first, pair.second);
+            }
+            row("status", "scheduled", report.status.scheduled);
+            row("status", "in_progress", report.status.inProgress);
+            row("status", "completed", report.status.completed);
+            row("status", "cancelled", report.status.cancelled);
+            row("status", "no_show", report.status.noShow);
+        }
+    }
+    
+    void ReportWriter::Write(const EmployeeReport& report) {
+        Write(std::vector<EmployeeReport>(1, report));
+    }
+    
+    void ReportWriter::Write(const std::vector<EmployeeReport>& reports) {
+        if (m_format == ReportFormat::CSV) {
+            m_buffer.Append("employee_id,employee_name,total_appointments,total_revenue,total_minutes\n");
+        }
+        
+        for (const auto& report : reports) {
+            if (m_format == ReportFormat::TEXT) {
+                m_buffer.Append("=== Employee Report for ").Append(report.employeeName).Append(" ===\n");
+                m_buffer.Append("Total Appointments: ").AppendInteger(report.totalAppointments).Append('\n');
+                m_buffer.Append("Total Revenue Generated: $").AppendPrice(report.totalRevenue).Append('\n');
+                m_buffer.Append("Total Working Time: ").AppendInteger(report.totalMinutes / 60)
+                        .Append(" hours and ").AppendInteger(report.totalMinutes % 60).Append(" minutes\n");
+            } else if (m_format == ReportFormat::JSON) {
+                m_buffer.Append('{');
+                _AppendJsonKey("employee_id", true);
+                m_buffer.AppendInteger(report.employeeId);
+                _AppendJsonKey("employee_name", false);
+                _AppendString(report.employeeName);
+                _AppendJsonKey("total_appointments", false);
+                m_buffer.AppendInteger(report.totalAppointments);
+                _AppendJsonKey("total_revenue", false);
+                m_buffer.AppendPrice(report.totalRevenue);
+                _AppendJsonKey("total_minutes", false);
+                m_buffer.AppendInteger(report.totalMinutes);
+                m_buffer.Append("}\n");
+            } else {
+                m_buffer.AppendInteger(report.employeeId).Append(',');
+                _AppendString(report.employeeName);
+                m_buffer.Append(',').AppendInteger(report.totalAppointments)
+                        .Append(',').AppendPrice(report.totalRevenue)
+                        .Append(',').AppendInteger(report.totalMinutes).Append('\n');
+            }
+        }
+    }
+    
+    void ReportWriter::Write(const PayrollReport& report) {
+        if (m_format == ReportFormat::TEXT) {
+            m_buffer.Append("=== Payroll for Days ").AppendInteger(report.firstDay).Append('-')
+                    .AppendInteger(report.lastDay).Append(" ===\n");
+            for (const auto& entry : report.entries) {
+                m_buffer.Append(" - ").Append(entry.employeeName).Append(": ")
+                        .AppendInteger(entry.completedAppointments).Append(" appointments, ")
+                        .AppendInteger(entry.workedMinutes).Append(" min, hourly $").AppendPrice(entry.hourlyPay)
+                        .Append(", commission $").AppendPrice(entry.commission)
+                        .Append(", total $").AppendPrice(entry.totalPay).Append('\n');
+            }
+            m_buffer.Append("Total Hourly Pay: $").AppendPrice(report.totalHourlyPay).Append('\n');
+            m_buffer.Append("Total Commission: $").AppendPrice(report.totalCommission).Append('\n');
+            m_buffer.Append("Total Payroll: $").AppendPrice(report.totalPay).Append('\n');
+        } else if (m_format == ReportFormat::JSON) {
+            for (const auto& entry : report.entries) {
+                m_buffer.Append('{');
+                _AppendJsonKey("first_day", true);
+                m_buffer.AppendInteger(report.firstDay);
+                _AppendJsonKey("last_day", false);
+                m_buffer.AppendInteger(report.lastDay);
+                _AppendJsonKey("employee_id", false);
+                m_buffer.AppendInteger(entry.employeeId);
+                _AppendJsonKey("employee_name", false);
+                _AppendString(entry.employeeName);
+                _AppendJsonKey("completed_appointments", false);
+                m_buffer.AppendInteger(entry.completedAppointments);
+                _AppendJsonKey("worked_minutes", false);
+                m_buffer.AppendInteger(entry.workedMinutes);
+                _AppendJsonKey("revenue", false);
+                m_buffer.AppendPrice(entry.revenue);
+                _AppendJsonKey("hourly_pay", false);
+                m_buffer.AppendPrice(entry.hourlyPay);
+                _AppendJsonKey("commission", false);
+                m_buffer.AppendPrice(entry.commission);
+                _AppendJsonKey("total_pay", false);
+                m_buffer.AppendPrice(entry.totalPay);
+                m_buffer.Append("}\n");
+            }
+        } else {
+            m_buffer.Append("first_day,last_day,employee_id,employee_name,completed_appointments,worked_minutes,"
+                            "revenue,hourly_pay,commission,total_pay\n");
+            for (const auto& entry : report.entries) {
+                m_buffer.AppendInteger(report.firstDay).Append(',').AppendInteger(report.lastDay).Append(',')
+                        .AppendInteger(entry.employeeId).Append(',');
+                _AppendString(entry.employeeName);
+                m_buffer.Append(',').AppendInteger(entry.completedAppointments)
+                        .Append(',').AppendInteger(entry.workedMinutes)
+                        .Append(',').AppendPrice(entry.revenue)
+                        .Append(',').AppendPrice(entry.hourlyPay)
+                        .Append(',').AppendPrice(entry.commission)
+                        .Append(',').AppendPrice(entry.totalPay).Append('\n');
+            }
+        }
+    }
+    
+    void ReportWriter::Write(const MetricsSnapshot& snapshot) {
+        // Percentilele exportate pentru fiecare operatie
+        static const double percentiles[] = {50.0, 90.0, 99.0, 99.9};
+        static const char* const percentileNames[] = {"p50", "p90", "p99", "p999"};
+        const auto perOperation = [&snapshot](size_t op) {
+            std::uint64_t count = snapshot.latency[op].GetCount();
+            return count == 0 ? 0.0 : static_cast<double>(snapshot.operationAllocations[op]) / static_cast<double>(count);
+        };
+        
+        if (m_format == ReportFormat::TEXT) {
+            m_buffer.Append("=== Metrics (").Append(snapshot.enabled ? "enabled" : "disabled, build with -DSALON_METRICS")
+                    .Append(", threads ").AppendInteger(static_cast<long long>(snapshot.threadCount)).Append(") ===\n");
+            m_buffer.Append("Latency (ns):\n");
+            for (size_t op = 0; op < METRIC_OPERATION_COUNT; ++op) {
+                const LatencyHistogram& histogram = snapshot.latency[op];
+                m_buffer.Append(" - ").Append(GetOperationName(static_cast<MetricOperation>(op)))
+                        .Append(": count ").AppendInteger(static_cast<long long>(histogram.GetCount()))
+                        .Append(", mean ").AppendInteger(static_cast<long long>(histogram.GetMean()));
+                for (size_t i = 0; i < 4; ++i) {
+                    m_buffer.Append(", ").Append(percentileNames[i]).Append(' ')
+                            .AppendInteger(static_cast<long long>(histogram.GetPercentile(percentiles[i])));
+                }
+                m_buffer.Append(", max ").AppendInteger(static_cast<long long>(histogram.GetMax()))
+                        .Append(", allocations/op ").AppendPrice(perOperation(op)).Append('\n');
+            }
+            m_buffer.Append("Rejections:\n");
+            for (size_t i = 0; i < REJECTION_REASON_COUNT; ++i) {
+                m_buffer.Append(" - ").Append(GetRejectionName(static_cast<RejectionReason>(i))).Append(": ")
+                        .AppendInteger(static_cast<long long>(snapshot.rejections[i])).Append('\n');
+            }
+            m_buffer.Append("Allocations: ").AppendInteger(static_cast<long long>(snapshot.allocations))
+                    .Append(" (").AppendInteger(static_cast<long long>(snapshot.allocatedBytes)).Append(" bytes)\n");
+        } else if (m_format == ReportFormat::JSON) {
+            m_buffer.Append('{');
+            _AppendJsonKey("enabled", true);
+            m_buffer.Append(snapshot.enabled ? "true" : "false");
+            _AppendJsonKey("threads", false);
+            m_buffer.AppendInteger(static_cast<long long>(snapshot.threadCount));
+            _AppendJsonKey("latency_ns", false);
+            m_buffer.Append('{');
+            for (size_t op = 0; op < METRIC_OPERATION_COUNT; ++op) {
+                const LatencyHistogram& histogram = snapshot.latency[op];
+                _AppendJsonKey(GetOperationName(static_cast<MetricOperation>(op)), op == 0);
+                m_buffer.Append('{');
+                _AppendJsonKey("count", true);
+                m_buffer.AppendInteger(static_cast<long long>(histogram.GetCount()));
+                _AppendJsonKey("mean", false);
+                m_buffer.AppendInteger(static_cast<long long>(histogram.GetMean()));
+                for (size_t i = 0; i < 4; ++i) {
+                    _AppendJsonKey(percentileNames[i], false);
+                    m_buffer.AppendInteger(static_cast<long long>(histogram.GetPercentile(percentiles[i])));
+                }
+                _AppendJsonKey("max", false);
+                m_buffer.AppendInteger(static_cast<long long>(histogram.GetMax()));
+                _AppendJsonKey("allocations", false);
+                m_buffer.AppendInteger(static_cast<long long>(snapshot.operationAllocations[op]));
+                m_buffer.Append('}');
+            }
+            m_buffer.Append('}');
+            _AppendJsonKey("rejections", false);
+            m_buffer.Append('{');
+            for (size_t i = 0; i < REJECTION_REASON_COUNT; ++i) {
+                _AppendJsonKey(GetRejectionName(static_cast<RejectionReason>(i)), i == 0);
+                m_buffer.AppendInteger(static_cast<long long>(snapshot.rejections[i]));
+            }
+            m_buffer.Append('}');
+            _AppendJsonKey("allocations", false);
+            m_buffer.AppendInteger(static_cast<long long>(snapshot.allocations));
+            _AppendJsonKey("allocated_bytes", false);
+            m_buffer.AppendInteger(static_cast<long long>(snapshot.allocatedBytes));
+            m_buffer.Append("}\n");
+        } else {
+            // CSV in format lung: o linie pentru fiecare metrica
+            const auto row = [this](const char* metric, const char* name, std::uint64_t value) {
+                m_buffer.Append(metric).Append(',').Append(name).Append(',')
+                        .AppendInteger(static_cast<long long>(value)).Append('\n');
+            };
+            m_buffer.Append("metric,name,value\n");
+            for (size_t op = 0; op < METRIC_OPERATION_COUNT; ++op) {
+                const LatencyHistogram& histogram = snapshot.latency[op];
+                const char* name = GetOperationName(static_cast<MetricOperation>(op));
+                row("count", name, histogram.GetCount());
+                row("mean_ns", name, histogram.GetMean());
+                row("p50_ns", name, histogram.GetPercentile(50.0));
+                row("p90_ns", name, histogram.GetPercentile(90.0));
+                row("p99_ns", name, histogram.GetPercentile(99.0));
+                row("p999_ns", name, histogram.GetPercentile(99.9));
+                row("max_ns", name, histogram.GetMax());
+                row("allocations", name, snapshot.operationAllocations[op]);
+            }
+            for (size_t i = 0; i < REJECTION_REASON_COUNT; ++i) {
+                row("rejections", GetRejectionName(static_cast<RejectionReason>(i)), snapshot.rejections[i]);
+            }
+            row("allocations", "total", snapshot.allocations);
+            row("allocated_bytes", "total", snapshot.allocatedBytes);
+        }
+    }
+    
+    void ReportWriter::Write(const ScheduleReport& report) {
+        if (m_format == ReportFormat::TEXT) {
+            m_buffer.Append("=== Schedule for Hour ").AppendInteger(report.date).Append(" ===\n");
+            if (report.entries.empty()) {
+                m_buffer.Append("No appointments scheduled.\n");
+            }
+            for (const auto& entry : report.entries) {
+                m_buffer.Append("App #").AppendInteger(entry.appointmentId).Append(" - ").Append(entry.clientName);
+                if (!entry.serviceName.empty()) {
+                    m_buffer.Append(" - ").Append(entry.serviceName);
+                }
+                m_buffer.Append(" at ").AppendTimeSlot(entry.timeSlot)
+                        .Append(" [").Append(GetStatusCode(entry.status)).Append("]\n");
+            }
+        } else if (m_format == ReportFormat::JSON) {
+            m_buffer.Append('{');
+            _AppendJsonKey("date", true);
+            m_buffer.AppendInteger(report.date);
+            _AppendJsonKey("appointments", false);
+            m_buffer.Append('[');
+            for (size_t i = 0; i < report.entries.size(); ++i) {
+                const ScheduleEntry& entry = report.entries[i];
+                if (i > 0) {
+                    m_buffer.Append(',');
+                }
+                m_buffer.Append('{');
+                _AppendJsonKey("id", true);
+                m_buffer.AppendInteger(entry.appointmentId);
+                _AppendJsonKey("client", false);
+                _AppendString(entry.clientName);
+                _AppendJsonKey("service", false);
+                _AppendString(entry.serviceName);
+                _AppendJsonKey("day", false);
+                m_buffer.AppendInteger(entry.timeSlot.GetDay());
+                _AppendJsonKey("start_minute", false);
+                m_buffer.AppendInteger(entry.timeSlot.GetStartMinute());
+                _AppendJsonKey("duration", false);
+                m_buffer.AppendInteger(entry.timeSlot.GetDuration());
+                _AppendJsonKey("status", false);
+                m_buffer.Append('"').Append(GetStatusCode(entry.status)).Append('"');
+                _AppendJsonKey("total_price", false);
+                m_buffer.AppendPrice(entry.totalPrice);
+                m_buffer.Append('}');
+            }
+            m_buffer.Append("]}\n");
+        } else {
+            m_buffer.Append("id,client,service,day,start_minute,duration,status,total_price\n");
+            for (const auto& entry : report.entries) {
+                m_buffer.AppendInteger(entry.appointmentId).Append(',');
+                _AppendString(entry.clientName);
+                m_buffer.Append(',');
+                _AppendString(entry.serviceName);
+                m_buffer.Append(',').AppendInteger(entry.timeSlot.GetDay())
+                        .Append(',').AppendInteger(entry.timeSlot.GetStartMinute())
+                        .Append(',').AppendInteger(entry.timeSlot.GetDuration())
+                        .Append(',').Append(GetStatusCode(entry.status))
+                        .Append(',').AppendPrice(entry.totalPrice).Append('\n');
+            }
+        }
+    }
+    
+    void ReportWriter::Write(const PackageReport& report) {
+        if (m_format == ReportFormat::TEXT) {
+            m_buffer.Append("Package: ").Append(report.name).Append('\n');
+            m_buffer.Append("Discount: ").AppendPrice(report.discount).Append("%\n");
+            m_buffer.Append("Services included:\n");
+            for (const auto& item : report.items) {
+                m_buffer.Append(" - ").Append(item.name).Append(" ($").AppendPrice(item.price).Append(")\n");
+            }
+            m_buffer.Append("Total Price: $").AppendPrice(report.totalPrice).Append('\n');
+            m_buffer.Append("Total Duration: ").AppendInteger(report.totalMinutes).Append(" minutes\n");
+        } else if (m_format == ReportFormat::JSON) {
+            m_buffer.Append('{');
+            _AppendJsonKey("package", true);
+            _AppendString(report.name);
+            _AppendJsonKey("discount", false);
+            m_buffer.AppendPrice(report.discount);
+            _AppendJsonKey("services", false);
+            m_buffer.Append('[');
+            for (size_t i = 0; i < report.items.size(); ++i) {
+                if (i > 0) {
+                    m_buffer.Append(',');
+                }
+                m_buffer.Append('{');
+                _AppendJsonKey("name", true);
+                _AppendString(report.items[i].name);
+                _AppendJsonKey("price", false);
+                m_buffer.AppendPrice(report.items[i].price);
+                _AppendJsonKey("minutes", false);
+                m_buffer.AppendInteger(report.items[i].minutes);
+                m_buffer.Append('}');
+            }
+            m_buffer.Append(']');
+            _AppendJsonKey("total_price", false);
+            m_buffer.AppendPrice(report.totalPrice);
+            _AppendJsonKey("total_minutes", false);
+            m_buffer.AppendInteger(report.totalMinutes);
+            m_buffer.Append("}\n");
+        } else {
+            // Ultima linie ("TOTAL") contine totalurile pachetului, cu discount aplicat
+            m_buffer.Append("package,discount,item,price,minutes\n");
+            for (const auto& item : report.items) {
+                _AppendString(report.name);
+                m_buffer.Append(',').AppendPrice(report.discount).Append(',');
+                _AppendString(item.name);
+                m_buffer.Append(',').AppendPrice(item.price).Append(',').AppendInteger(item.minutes).Append('\n');
+            }
+            _AppendString(report.name);
+            m_buffer.Append(',').AppendPrice(report.discount).Append(",TOTAL,")
+                    .AppendPrice(report.totalPrice).Append(',').AppendInteger(report.totalMinutes).Append('\n');
+        }
+    }
+    
+    void ReportWriter::Write(const BundleReport& report) {
+        if (m_format == ReportFormat::TEXT) {
+            m_buffer.Append("Bundle: ").Append(report.name).Append('\n');
+            m_buffer.Append("Discount: ").AppendPrice(report.discount).Append("%\n");
+            m_buffer.Append("Products included:\n");
+            for (const auto& item : report.items) {
+                m_buffer.Append(" - ").Append(item.name).Append(" ($").AppendPrice(item.price).Append(")\n");
+            }
+            m_buffer.Append("Total Price: $").AppendPrice(report.totalPrice).Append('\n');
+        } else if (m_format == ReportFormat::JSON) {
+            m_buffer.Append('{');
+            _AppendJsonKey("bundle", true);
+            _AppendString(report.name);
+            _AppendJsonKey("discount", false);
+            m_buffer.AppendPrice(report.discount);
+            _AppendJsonKey("products", false);
+            m_buffer.Append('[');
+            for (size_t i = 0; i < report.items.size(); ++i) {
+                if (i > 0) {
+                    m_buffer.Append(',');
+                }
+                m_buffer.Append('{');
+                _AppendJsonKey("name", true);
+                _AppendString(report.items[i].name);
+                _AppendJsonKey("price", false);
+                m_buffer.AppendPrice(report.items[i].price);
+                m_buffer.Append('}');
+            }
+            m_buffer.Append(']');
+            _AppendJsonKey("total_price", false);
+            m_buffer.AppendPrice(report.totalPrice);
+            m_buffer.Append("}\n");
+        } else {
+            m_buffer.Append("bundle,discount,item,price\n");
+            for (const auto& item : report.items) {
+                _AppendString(report.name);
+                m_buffer.Append(',').AppendPrice(report.discount).Append(',');
+                _AppendString(item.name);
+                m_buffer.Append(',').AppendPrice(item.price).Append('\n');
+            }
+            _AppendString(report.name);
+            m_buffer.Append(',').AppendPrice(report.discount).Append(",TOTAL,")
+                    .AppendPrice(report.totalPrice).Append('\n');
+        }
+    }
+}
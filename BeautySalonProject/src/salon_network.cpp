@@ -0,0 +1,255 @@
+#include "salon_network.h"
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+namespace Beauty_Salon {
+    namespace {
+        constexpr double EARTH_RADIUS_KM = 6371.0;
+        constexpr double PI = 3.14159265358979323846;
+        
+        // Filialele cautate de o sarcina (cautarea intr-o filiala parcurge toate programarile ei)
+        constexpr size_t BRANCHES_PER_TASK = 1;
+        
+        double ToRadians(double degrees) {
+            return degrees * PI / 180.0;
+        }
+        
+        // O filiala candidata la cautare si intervalele gasite in ea
+        struct BranchSearch {
+            const Branch* branch;
+            Service* service;
+            double distanceKm;
+            std::vector<TimeSlot> slots;
+        };
+    }
+    
+    // Implementarea GeoPoint
+    GeoPoint::GeoPoint() : latitude(0.0), longitude(0.0) {
+    }
+    
+    GeoPoint::GeoPoint(double lat, double lon) : latitude(lat), longitude(lon) {
+    }
+    
+    double DistanceKm(const GeoPoint& a, const GeoPoint& b) {
+        double dLat = ToRadians(b.latitude - a.latitude);
+        double dLon = ToRadians(b.longitude - a.longitude);
+        double h = std::sin(dLat / 2) * std::sin(dLat / 2) +
+                   std::cos(ToRadians(a.latitude)) * std::cos(ToRadians(b.latitude)) *
+                   std::sin(dLon / 2) * std::sin(dLon / 2);
+        return 2.0 * EARTH_RADIUS_KM * std::asin(std::min(1.0, std::sqrt(h)));
+    }
+    
+    // Implementarea Branch
+    Branch::Branch(int id, const std::string& name, const GeoPoint& location)
+        : m_id(id), m_name(name), m_location(location) {
+        m_schedule.SetServiceCatalog(&m_catalog);
+    }
+    
+    int Branch::GetID() const {
+        return m_id;
+    }
+    
+    const std::string& Branch::GetName() const {
+        return m_name;
+    }
+    
+    const GeoPoint& Branch::GetLocation() const {
+        return m_location;
+    }
+    
+    Service* Branch::AddService(std::unique_ptr<Service> service) {
+        return m_catalog.AddService(std::move(service));
+    }
+    
+    Employee* Branch::AddEmployee(std::unique_ptr<Employee> employee) {
+        if (!employee) {
+            return nullptr;
+        }
+        m_employees.push_back(std::move(employee));
+        return m_employees.back().get();
+    }
+    
+    const std::vector<std::unique_ptr<Employee>>& Branch::GetEmployees() const {
+        return m_employees;
+    }
+    
+    void Branch::RebuildQualifications() {
+        m_catalog.BuildQualifications(m_employees);
+    }
+    
+    void Branch::EnableShifts() {
+        m_schedule.SetShiftRoster(&m_roster);
+    }
+    
+    ShiftRoster& Branch::GetRoster() {
+        return m_roster;
+    }
+    
+    ServiceCatalog& Branch::GetCatalog() {
+        return m_catalog;
+    }
+    
+    const ServiceCatalog& Branch::GetCatalog() const {
+        return m_catalog;
+    }
+    
+    Schedule& Branch::GetSchedule() {
+        return m_schedule;
+    }
+    
+    const Schedule& Branch::GetSchedule() const {
+        return m_schedule;
+    }
+    
+    // Implementarea SlotOffer
+    SlotOffer::SlotOffer() : branchId(-1), distanceKm(0.0), service(nullptr), slot() {
+    }
+    
+    bool IsEarlierOffer(const SlotOffer& lhs, const SlotOffer& rhs) {
+        if (lhs.slot.GetAbsoluteStart() != rhs.slot.GetAbsoluteStart()) {
+            return lhs.slot.GetAbsoluteStart() < rhs.slot.GetAbsoluteStart();
+        }
+        if (lhs.distanceKm != rhs.distanceKm) {
+            return lhs.distanceKm < rhs.distanceKm;
+        }
+        return lhs.branchId < rhs.branchId;
+    }
+    
+    // Implementarea SalonNetwork
+    SalonNetwork::SalonNetwork() : m_task_pool(nullptr) {
+    }
+    
+    Branch& SalonNetwork::AddBranch(const std::string& name, const GeoPoint& location) {
+        int id = static_cast<int>(m_branches.size());
+        m_branches.push_back(std::unique_ptr<Branch>(new Branch(id, name, location)));
+        return *m_branches.back();
+    }
+    
+    size_t SalonNetwork::GetBranchCount() const {
+        return m_branches.size();
+    }
+    
+    Branch* SalonNetwork::FindBranch(int branchId) {
+        if (branchId < 0 || static_cast<size_t>(branchId) >= m_branches.size()) {
+            return nullptr;
+        }
+        return m_branches[branchId].get();
+    }
+    
+    const Branch* SalonNetwork::FindBranch(int branchId) const {
+        if (branchId < 0 || static_cast<size_t>(branchId) >= m_branches.size()) {
+            return nullptr;
+        }
+        return m_branches[branchId].get();
+    }
+    
+    const std::vector<std::unique_ptr<Branch>>& SalonNetwork::GetBranches() const {
+        return m_branches;
+    }
+    
+    std::vector<const Branch*> SalonNetwork::FindBranchesWithin(const GeoPoint& origin, double radiusKm) const {
+        std::vector<const Branch*> result;
+        for (const auto& branch : m_branches) {
+            if (DistanceKm(origin, branch->GetLocation()) <= radiusKm) {
+                result.push_back(branch.get());
+            }
+        }
+        return result;
+    }
+    
+    TaskPool* SalonNetwork::GetTaskPool() const {
+        return m_task_pool;
+    }
+    
+    void SalonNetwork::SetTaskPool(TaskPool* pool) {
+        m_task_pool = pool;
+    }
+    
+    bool SalonNetwork::Book(int branchId, const Client& client, const std::string& serviceName, const TimeSlot& slot) {
+        Branch* branch = FindBranch(branchId);
+        if (!branch) {
+            return false;
+        }
+        Service* service = branch->GetCatalog().FindByName(serviceName);
+        if (!service) {
+            return false;
+        }
+        return branch->GetSchedule().AddAppointment(client, service, slot);
+    }
+    
+    bool SalonNetwork::Book(const SlotOffer& offer, const Client& client) {
+        Branch* branch = FindBranch(offer.branchId);
+        if (!branch || !offer.service) {
+            return false;
+        }
+        return branch->GetSchedule().AddAppointment(client, offer.service, offer.slot);
+    }
+    
+    std::vector<SlotOffer> SalonNetwork::FindEarliestSlots(const std::string& serviceName, const GeoPoint& origin,
+                                                           double radiusKm, int firstDay, int dayCount,
+                                                           size_t maxCount) const {
+        std::vector<SlotOffer> result;
+        if (maxCount == 0 || dayCount <= 0) {
+            return result;
+        }
+        
+        // Filialele din raza care ofera serviciul
+        std::vector<BranchSearch> searches;
+        for (const auto& branch : m_branches) {
+            double distance = DistanceKm(origin, branch->GetLocation());
+            if (distance > radiusKm) {
+                continue;
+            }
+            Service* service = branch->GetCatalog().FindByName(serviceName);
+            if (service) {
+                searches.push_back(BranchSearch{branch.get(), service, distance, {}});
+            }
+        }
+        
+        // Fiecare sarcina cauta intr-o filiala; fiecare filiala are nevoie de cel mult maxCount intervale
+        TaskPool& pool = m_task_pool ? *m_task_pool : TaskPool::GetDefault();
+        pool.ParallelFor(0, searches.size(), BRANCHES_PER_TASK, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                searches[i].slots = searches[i].branch->GetSchedule().FindEarliestSlots(searches[i].service, firstDay,
+                                                                                         dayCount, maxCount);
+            }
+        });
+        
+        // Interclasam listele sortate ale filialelor: heap cu urmatoarea oferta din fiecare filiala
+        auto makeOffer = [&](size_t search, size_t position) {
+            SlotOffer offer;
+            offer.branchId = searches[search].branch->GetID();
+            offer.distanceKm = searches[search].distanceKm;
+            offer.service = searches[search].service;
+            offer.slot = searches[search].slots[position];
+            return offer;
+        };
+        
+        struct HeapEntry {
+            SlotOffer offer;
+            size_t search;
+            size_t position;
+        };
+        auto later = [](const HeapEntry& lhs, const HeapEntry& rhs) {
+            return IsEarlierOffer(rhs.offer, lhs.offer);
+        };
+        std::priority_queue<HeapEntry, std::vector<HeapEntry>, decltype(later)> heap(later);
+        for (size_t i = 0; i < searches.size(); ++i) {
+            if (!searches[i].slots.empty()) {
+                heap.push(HeapEntry{makeOffer(i, 0), i, 0});
+            }
+        }
+        
+        result.reserve(maxCount);
+        while (!heap.empty() && result.size() < maxCount) {
+            HeapEntry top = heap.top();
+            heap.pop();
+            result.push_back(top.offer);
+            if (top.position + 1 < searches[top.search].slots.size()) {
+                heap.push(HeapEntry{makeOffer(top.search, top.position + 1), top.search, top.position + 1});
+            }
+        }
+        return result;
+    }
+}
@@ -0,0 +1,369 @@
+#include "salon_server.h"
+
+#ifdef __linux__
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace Beauty_Salon {
+    namespace {
+        constexpr int MAX_EVENTS = 256;
+        constexpr std::size_t READ_BUFFER_BYTES = 64 * 1024;
+        // Conexiuni acceptate la o singura trezire, ca un val de conexiuni sa nu blocheze clientii existenti
+        constexpr int MAX_ACCEPTS_PER_WAKEUP = 64;
+    }
+    
+    // Implementarea SalonServerStats
+    SalonServerStats::SalonServerStats()
+        : accepted(0), closed(0), commands(0), bytesIn(0), bytesOut(0), wakeups(0), maxConnections(0) {
+    }
+    
+    // Implementarea SalonServer
+    SalonServer::Connection::Connection(int socket, ReportFormat connectionFormat, std::uint64_t wakeup)
+        : fd(socket), outputOffset(0), format(connectionFormat), acceptedWakeup(wakeup), readPaused(false),
+          closing(false), events(EPOLLIN) {
+    }
+    
+    SalonServer::SalonServer(CommandProcessor& processor)
+        : m_processor(processor), m_default_format(processor.GetFormat()), m_listen_fd(-1), m_epoll_fd(-1), m_wake_fd(-1), m_port(0),
+          m_open_connections(0), m_read_buffer(READ_BUFFER_BYTES) {
+        m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        m_wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_epoll_fd >= 0 && m_wake_fd >= 0) {
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.fd = m_wake_fd;
+            epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_wake_fd, &event);
+        }
+    }
+    
+    SalonServer::~SalonServer() {
+        for (auto& connection : m_connections) {
+            if (connection) {
+                close(connection->fd);
+            }
+        }
+        if (m_listen_fd >= 0) {
+            close(m_listen_fd);
+        }
+        if (m_wake_fd >= 0) {
+            close(m_wake_fd);
+        }
+        if (m_epoll_fd >= 0) {
+            close(m_epoll_fd);
+        }
+    }
+    
+    bool SalonServer::Listen(const std::string& address, std::uint16_t port, int backlog) {
+        if (m_epoll_fd < 0 || m_wake_fd < 0 || m_listen_fd >= 0) {
+            return false;
+        }
+        
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        if (inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1) {
+            return false;
+        }
+        
+        int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            return false;
+        }
+        int enable = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+        if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(fd, backlog) != 0) {
+            close(fd);
+            return false;
+        }
+        
+        // Portul efectiv (pentru port 0)
+        socklen_t length = sizeof(addr);
+        getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &length);
+        m_port = ntohs(addr.sin_port);
+        
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+            close(fd);
+            return false;
+        }
+        m_listen_fd = fd;
+        return true;
+    }
+    
+    std::uint16_t SalonServer::GetPort() const {
+        return m_port;
+    }
+    
+    const SalonServerStats& SalonServer::GetStats() const {
+        return m_stats;
+    }
+    
+    void SalonServer::Stop() {
+        // write pe eventfd este sigur si dintr-un handler de semnal
+        std::uint64_t one = 1;
+        ssize_t written = write(m_wake_fd, &one, sizeof(one));
+        (void)written;
+    }
+    
+    bool SalonServer::Run() {
+        if (m_listen_fd < 0) {
+            return false;
+        }
+        
+        epoll_event events[MAX_EVENTS];
+        bool running = true;
+        while (running) {
+            int count = epoll_wait(m_epoll_fd, events, MAX_EVENTS, -1);
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            m_stats.wakeups++;
+            
+            for (int i = 0; i < count; ++i) {
+                int fd = events[i].data.fd;
+                if (fd == m_wake_fd) {
+                    std::uint64_t value;
+                    ssize_t received = read(m_wake_fd, &value, sizeof(value));
+                    (void)received;
+                    running = false;
+                    continue;
+                }
+                if (fd == m_listen_fd) {
+                    _Accept();
+                    continue;
+                }
+                
+                // Conexiunea poate sa fi fost inchisa de un eveniment anterior din acelasi lot; daca descriptorul a fost
+                // refolosit de o conexiune acceptata tot acum, evenimentul este al celei vechi
+                if (static_cast<std::size_t>(fd) >= m_connections.size() || !m_connections[fd] ||
+                    m_connections[fd]->acceptedWakeup == m_stats.wakeups) {
+                    continue;
+                }
+                Connection& connection = *m_connections[fd];
+                std::uint32_t flags = events[i].events;
+                if (flags & EPOLLERR) {
+                    _Close(connection);
+                    continue;
+                }
+                if (flags & EPOLLHUP) {
+                    // Clientul a inchis ambele sensuri: golim ce a trimis, daca mai citim de la el; raspunsurile
+                    // netrimise nu mai pot ajunge, iar EPOLLHUP s-ar repeta la fiecare trezire
+                    if (connection.readPaused || connection.closing) {
+                        _Close(connection);
+                    } else {
+                        _Read(connection);
+                    }
+                    continue;
+                }
+                if ((flags & EPOLLIN) && !connection.readPaused) {
+                    _Read(connection);
+                }
+                if ((flags & EPOLLOUT) && m_connections[fd]) {
+                    _Write(*m_connections[fd]);
+                }
+            }
+        }
+        return true;
+    }
+    
+    void SalonServer::_Accept() {
+        for (int i = 0; i < MAX_ACCEPTS_PER_WAKEUP; ++i) {
+            int fd = accept4(m_listen_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0) {
+                // EAGAIN: nu mai sunt conexiuni in asteptare; EMFILE etc.: reincercam la urmatoarea trezire
+                return;
+            }
+            
+            // Raspunsurile sunt mici si trebuie trimise imediat
+            int enable = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+            
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.fd = fd;
+            if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+                close(fd);
+                continue;
+            }
+            
+            if (static_cast<std::size_t>(fd) >= m_connections.size()) {
+                m_connections.resize(static_cast<std::size_t>(fd) + 1);
+            }
+            m_connections[fd].reset(new Connection(fd, m_default_format, m_stats.wakeups));
+            m_open_connections++;
+            m_stats.accepted++;
+            m_stats.maxConnections = std::max(m_stats.maxConnections, m_open_connections);
+        }
+    }
+    
+    void SalonServer::_Read(Connection& connection) {
+        // O singura citire pe trezire: conexiunile foarte active nu le infometeaza pe celelalte
+        ssize_t received = recv(connection.fd, m_read_buffer.data(), m_read_buffer.size(), 0);
+        if (received < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                _Close(connection);
+            }
+            return;
+        }
+        if (received == 0) {
+            // Clientul a inchis scrierea: executam ultima linie neterminata si inchidem dupa trimiterea raspunsurilor
+            if (!connection.input.empty()) {
+                connection.input.push_back('\n');
+                std::string last;
+                last.swap(connection.input);
+                _ExecuteLines(connection, last.data(), last.size());
+            }
+            connection.closing = true;
+            _Flush(connection);
+            return;
+        }
+        
+        m_stats.bytesIn += static_cast<std::uint64_t>(received);
+        if (!_ExecuteLines(connection, m_read_buffer.data(), static_cast<std::size_t>(received))) {
+            connection.closing = true;
+        }
+        _Flush(connection);
+    }
+    
+    bool SalonServer::_ExecuteLines(Connection& connection, const char* data, std::size_t size) {
+        m_processor.SetFormat(connection.format);
+        m_processor.SwapBookingReferences(connection.bookingIds);
+        
+        const char* end = data + size;
+        const char* start = data;
+        bool keepOpen = true;
+        while (start < end) {
+            const char* newline = static_cast<const char*>(std::memchr(start, '\n', static_cast<std::size_t>(end - start)));
+            if (!newline) {
+                break;
+            }
+            if (connection.input.empty()) {
+                m_processor.ExecuteLine(std::string_view(start, static_cast<std::size_t>(newline - start)), m_responses);
+            } else {
+                connection.input.append(start, newline);
+                m_processor.ExecuteLine(connection.input, m_responses);
+                connection.input.clear();
+            }
+            m_stats.commands++;
+            start = newline + 1;
+            
+            if (m_processor.IsQuitRequested()) {
+                m_processor.ClearQuitRequest();
+                keepOpen = false;
+                break;
+            }
+        }
+        
+        if (keepOpen) {
+            connection.input.append(start, end);
+            if (connection.input.size() > MAX_LINE_BYTES) {
+                // Raspunsul urmeaza formatul conexiunii, ca un client JSON sa-l poata citi
+                m_responses.Append(m_processor.GetFormat() == ReportFormat::JSON
+                                   ? "{\"ok\":false,\"command\":\"\",\"error\":\"line_too_long\"}\n"
+                                   : "ERR - error=line_too_long\n");
+                connection.input.clear();
+                keepOpen = false;
+            }
+        }
+        connection.format = m_processor.GetFormat();
+        m_processor.SwapBookingReferences(connection.bookingIds);
+        return keepOpen;
+    }
+    
+    void SalonServer::_Flush(Connection& connection) {
+        const char* data = m_responses.Data();
+        std::size_t size = m_responses.Size();
+        
+        // Daca exista deja raspunsuri netrimise, cele noi trebuie sa astepte dupa ele
+        if (connection.outputOffset == connection.output.size() && size > 0) {
+            ssize_t sent = send(connection.fd, data, size, MSG_NOSIGNAL);
+            if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                m_responses.Clear();
+                _Close(connection);
+                return;
+            }
+            if (sent > 0) {
+                m_stats.bytesOut += static_cast<std::uint64_t>(sent);
+                data += sent;
+                size -= static_cast<std::size_t>(sent);
+            }
+        }
+        connection.output.append(data, size);
+        m_responses.Clear();
+        
+        if (connection.outputOffset == connection.output.size()) {
+            connection.output.clear();
+            connection.outputOffset = 0;
+            if (connection.closing) {
+                _Close(connection);
+                return;
+            }
+        }
+        connection.readPaused = connection.output.size() - connection.outputOffset > MAX_PENDING_OUTPUT;
+        _UpdateEvents(connection);
+    }
+    
+    void SalonServer::_Write(Connection& connection) {
+        while (connection.outputOffset < connection.output.size()) {
+            ssize_t sent = send(connection.fd, connection.output.data() + connection.outputOffset,
+                                connection.output.size() - connection.outputOffset, MSG_NOSIGNAL);
+            if (sent < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                    _Close(connection);
+                    return;
+                }
+                break;
+            }
+            m_stats.bytesOut += static_cast<std::uint64_t>(sent);
+            connection.outputOffset += static_cast<std::size_t>(sent);
+        }
+        _Flush(connection);
+    }
+    
+    void SalonServer::_UpdateEvents(Connection& connection) {
+        std::uint32_t events = 0;
+        if (!connection.readPaused && !connection.closing) {
+            events |= EPOLLIN;
+        }
+        if (connection.outputOffset < connection.output.size()) {
+            events |= EPOLLOUT;
+        }
+        if (events == connection.events) {
+            return;
+        }
+        
+        epoll_event event{};
+        event.events = events;
+        event.data.fd = connection.fd;
+        epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, connection.fd, &event);
+        connection.events = events;
+    }
+    
+    void SalonServer::_Close(Connection& connection) {
+        int fd = connection.fd;
+        epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        close(fd);
+        m_connections[fd].reset();
+        m_open_connections--;
+        m_stats.closed++;
+    }
+}
+
+#endif // __linux__
@@ -1,16 +1,39 @@
 #include "schedule.h"
+#include "discount_rules.h"
+#include "service_catalog.h"
+#include "shift_calendar.h"
+#include "metrics.h"
 #include <iostream>
 #include <algorithm>
 #include <iomanip>
+#include <iterator>
+#include <unordered_map>
 
 namespace Beauty_Salon {
+    namespace {
+        // Sub acest numar de programari, interogarile ruleaza pe firul apelantului
+        constexpr size_t PARALLEL_MIN_APPOINTMENTS = 2048;
+        
+        // Intervalele candidate verificate de o sarcina
+        constexpr size_t SLOTS_PER_TASK = 8;
+        
+        // Programarile parcurse de o sarcina la calculul rapoartelor per angajat
+        constexpr size_t APPOINTMENTS_PER_TASK = 4096;
+    }
+    
     // Implementarea constructorilor
     Schedule::Schedule() 
-        : m_working_start_hour(9), m_working_end_hour(20), m_max_concurrent_apps(5) {
+        : m_working_start_hour(9), m_working_end_hour(20), m_max_concurrent_apps(5),
+          m_intervals_dirty(false), m_catalog(nullptr), m_consumption_sink(nullptr), m_roster(nullptr),
+          m_task_pool(nullptr), m_discounts(nullptr) {
+        m_utilization.SetDailyCapacity((m_working_end_hour - m_working_start_hour) * 60);
     }
     
     Schedule::Schedule(int startHour, int endHour, int maxConcurrentApps) 
-        : m_working_start_hour(startHour), m_working_end_hour(endHour), m_max_concurrent_apps(maxConcurrentApps) {
+        : m_working_start_hour(startHour), m_working_end_hour(endHour), m_max_concurrent_apps(maxConcurrentApps),
+          m_intervals_dirty(false), m_catalog(nullptr), m_consumption_sink(nullptr), m_roster(nullptr),
+          m_task_pool(nullptr), m_discounts(nullptr) {
+        m_utilization.SetDailyCapacity((m_working_end_hour - m_working_start_hour) * 60);
     }
     
     // Getteri si setteri
@@ -26,10 +49,73 @@ namespace Beauty_Salon {
         return m_max_concurrent_apps;
     }
     
+    const ServiceCatalog* Schedule::GetServiceCatalog() const {
+        return m_catalog;
+    }
+    
+    void Schedule::SetServiceCatalog(const ServiceCatalog* catalog) {
+        m_catalog = catalog;
+    }
+    
+    IConsumptionSink* Schedule::GetConsumptionSink() const {
+        return m_consumption_sink;
+    }
+    
+    void Schedule::SetConsumptionSink(IConsumptionSink* sink) {
+        m_consumption_sink = sink;
+    }
+    
+    const ShiftRoster* Schedule::GetShiftRoster() const {
+        return m_roster;
+    }
+    
+    void Schedule::SetShiftRoster(const ShiftRoster* roster) {
+        m_roster = roster;
+    }
+    
+    TaskPool* Schedule::GetTaskPool() const {
+        return m_task_pool;
+    }
+    
+    void Schedule::SetTaskPool(TaskPool* pool) {
+        m_task_pool = pool;
+    }
+    
+    const DiscountProgram* Schedule::GetDiscountProgram() const {
+        return m_discounts;
+    }
+    
+    void Schedule::SetDiscountProgram(const DiscountProgram* discounts) {
+        m_discounts = discounts;
+    }
+    
+    TaskPool& Schedule::_GetTaskPool() const {
+        return m_task_pool ? *m_task_pool : TaskPool::GetDefault();
+    }
+    
+    const UtilizationTracker& Schedule::GetUtilization() const {
+        _SyncIntervals();
+        return m_utilization;
+    }
+    
+    double Schedule::GetEmployeeBusyRatio(const Employee& employee, int firstDay, int dayCount) const {
+        return GetUtilization().GetBusyRatio(employee.GetID(), firstDay, dayCount);
+    }
+    
+    void Schedule::SetUtilizationWindow(int firstDay) {
+        m_utilization.ResetWindow(firstDay);
+        m_intervals_dirty = true;
+    }
+    
+    bool Schedule::IsEmployeeAvailable(const Employee* employee, const TimeSlot& slot) const {
+        return employee && _IsOnShift(employee, slot) && !_HasEmployeeConflict(slot, employee);
+    }
+    
     void Schedule::SetWorkingHours(int startHour, int endHour) {
         if (startHour >= 0 && startHour < 24 && endHour > startHour && endHour <= 24) {
             m_working_start_hour = startHour;
             m_working_end_hour = endHour;
+            m_utilization.SetDailyCapacity((endHour - startHour) * 60);
         }
     }
     
@@ -40,40 +126,84 @@ namespace Beauty_Salon {
     }
     
     // Metode helper private
-    bool Schedule::_IsTimeSlotAvailable(const TimeSlot& slot, Employee* employee) const {
-        // Verificam daca intervalul de timp se suprapune cu alte programari
+    void Schedule::_SyncIntervals() const {
+        if (!m_intervals_dirty) {
+            return;
+        }
+        m_intervals.Clear();
+        m_intervals.Reserve(m_appointments.size());
+        m_utilization.Clear();
         for (const auto& app : m_appointments) {
-            // Daca se doreste un angajat specific, verificam doar programarile acelui angajat
-            if (employee && app.GetEmployee() != employee) {
-                continue;
+            m_intervals.PushBack(app.GetTimeSlot());
+            if (_CountsTowardUtilization(app)) {
+                m_utilization.AddBooking(app.GetEmployee(), app.GetTimeSlot());
             }
-            
-            // Verificam suprapunerea intervalelor de timp
-            if (app.GetTimeSlot().OverlapsWith(slot)) {
-                // Verificam daca avem mai multe programari simultane decât limita
-                int count = 0;
-                for (const auto& a : m_appointments) {
-                    if (a.GetTimeSlot().OverlapsWith(slot)) {
-                        count++;
-                    }
-                }
-                if (count >= m_max_concurrent_apps) {
-                    return false;
+        }
+        m_intervals_dirty = false;
+    }
+    
+    bool Schedule::_CountsTowardUtilization(const Appointment& appointment) {
+        return appointment.GetEmployee() && appointment.GetStatus() != AppointmentStatus::CANCELLED;
+    }
+    
+    bool Schedule::_IsTimeSlotAvailable(const TimeSlot& slot, Employee* employee) const {
+        _SyncIntervals();
+        
+        // Numaram intr-o singura trecere programarile care se suprapun cu intervalul
+        size_t count = CountOverlaps(slot, m_intervals);
+        if (count == 0 || count < static_cast<size_t>(m_max_concurrent_apps)) {
+            return true;
+        }
+        
+        // Limita de programari simultane este atinsa; daca nu se doreste un angajat specific, intervalul e ocupat
+        if (!employee) {
+            return false;
+        }
+        
+        // Altfel intervalul este ocupat doar daca angajatul are o programare suprapusa
+        return !_HasEmployeeConflict(slot, employee);
+    }
+    
+    bool Schedule::_HasEmployeeConflict(const TimeSlot& slot, const Employee* employee) const {
+        _SyncIntervals();
+        
+        std::vector<std::uint64_t> mask;
+        ComputeOverlapMask(slot, m_intervals, mask);
+        for (size_t word = 0; word < mask.size(); ++word) {
+            std::uint64_t bits = mask[word];
+            while (bits) {
+                size_t index = word * 64 + static_cast<size_t>(__builtin_ctzll(bits));
+                if (m_appointments[index].GetEmployee() == employee) {
+                    return true;
                 }
+                bits &= bits - 1;
             }
         }
-        return true;
+        return false;
     }
     
     bool Schedule::_IsWithinWorkingHours(const TimeSlot& slot) const {
-        // Verificam daca intervalul de timp este în programul de lucru
-        int endMinutes = slot.hour * 60 + slot.minute + slot.duration;
-        int endHour = endMinutes / 60;
+        // Verificam daca intervalul de timp este în programul de lucru (si intr-o zi pe care o pot stoca intervalele)
+        int endHour = slot.GetEndMinute() / 60;
         
-        return slot.hour >= m_working_start_hour && endHour <= m_working_end_hour;
+        return slot.IsInDayRange() && slot.GetHour() >= m_working_start_hour && endHour <= m_working_end_hour;
+    }
+    
+    bool Schedule::_IsOnShift(const Employee* employee, const TimeSlot& slot) const {
+        return !m_roster || m_roster->IsAvailable(employee, slot);
     }
     
     Employee* Schedule::_FindAvailableEmployee(ServiceType type, const TimeSlot& slot) const {
+        if (!m_catalog) {
+            return nullptr;
+        }
+        
+        // Lista angajatilor calificati este precalculata in catalog; tura se verifica inaintea conflictelor (mai ieftin)
+        for (Employee* employee : m_catalog->GetQualifiedEmployees(type)) {
+            if (_IsOnShift(employee, slot) && !_HasEmployeeConflict(slot, employee)) {
+                return employee;
+            }
+        }
         return nullptr;
     }
     
@@ -87,39 +217,89 @@ namespace Beauty_Salon {
             for (int minute = 0; minute < 60; minute += 15) {
                 // Verificam daca serviciul poate fi finalizat inainte de inchidere
                 TimeSlot slot(hour, minute, serviceDuration);
-                int endMinutes = hour * 60 + minute + serviceDuration;
-                int endHour = endMinutes / 60;
+                int endHour = slot.GetEndMinute() / 60;
                 
-                if (endHour <= m_working_end_hour && _IsTimeSlotAvailable(slot, nullptr)) {
+                if (endHour <= m_working_end_hour) {
                     availableSlots.push_back(slot);
                 }
             }
         }
         
+        _FilterAvailableSlots(service, availableSlots);
         return availableSlots;
     }
     
+    void Schedule::_FilterAvailableSlots(const Service* service, std::vector<TimeSlot>& slots) const {
+        // Intervalul trebuie sa fie liber si, cu ture definite, sa poata fi luat de cel putin un angajat calificat
+        auto isAvailable = [this, service](const TimeSlot& slot) {
+            if (!_IsTimeSlotAvailable(slot, nullptr)) {
+                return false;
+            }
+            return !(m_roster && m_catalog && !_FindAvailableEmployee(service->GetType(), slot));
+        };
+        
+        if (m_appointments.size() < PARALLEL_MIN_APPOINTMENTS) {
+            slots.erase(std::remove_if(slots.begin(), slots.end(), 
+                                       [&isAvailable](const TimeSlot& slot) { return !isAvailable(slot); }), 
+                        slots.end());
+            return;
+        }
+        
+        // Sincronizam intervalele inainte de a le citi din mai multe fire
+        _SyncIntervals();
+        std::vector<unsigned char> keep(slots.size(), 0);
+        _GetTaskPool().ParallelFor(0, slots.size(), SLOTS_PER_TASK, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                keep[i] = isAvailable(slots[i]) ? 1 : 0;
+            }
+        });
+        
+        size_t kept = 0;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            if (keep[i]) {
+                slots[kept++] = slots[i];
+            }
+        }
+        slots.resize(kept);
+    }
+    
     // Metode pentru gestionarea programarilor
     bool Schedule::AddAppointment(const Appointment& appointment) {
+        SALON_MEASURE(SCHEDULE_ADD);
+        
         // Verificam daca programarea poate fi adaugata
         if (!_IsWithinWorkingHours(appointment.GetTimeSlot())) {
+            SALON_COUNT_REJECTION(OUTSIDE_WORKING_HOURS);
             return false;
         }
         
+        // Fara angajat ales, refuzul inseamna limita de programari simultane; cu angajat, o suprapunere a lui
         if (!_IsTimeSlotAvailable(appointment.GetTimeSlot(), appointment.GetEmployee())) {
+            if (appointment.GetEmployee()) {
+                SALON_COUNT_REJECTION(EMPLOYEE_CONFLICT);
+            } else {
+                SALON_COUNT_REJECTION(CAPACITY);
+            }
+            return false;
+        }
+        
+        // Angajatul ales trebuie sa fie in tura
+        if (appointment.GetEmployee() && !_IsOnShift(appointment.GetEmployee(), appointment.GetTimeSlot())) {
+            SALON_COUNT_REJECTION(OFF_SHIFT);
             return false;
         }
         
         // Adaugam programarea
         m_appointments.push_back(appointment);
+        if (m_consumption_sink && !appointment.GetConsumptionSink()) {
+            m_appointments.back().SetConsumptionSink(m_consumption_sink);
+        }
         
-        // Actualizam incarcarea angajatului
-        if (appointment.GetEmployee()) {
-            int employeeId = appointment.GetEmployee()->GetID();
-            if (m_employee_load.find(employeeId) == m_employee_load.end()) {
-                m_employee_load[employeeId] = 1;
-            } else {
-                m_employee_load[employeeId]++;
+        // Actualizam intervalele si incarcarea angajatului (daca sunt sincronizate; altfel se reconstruiesc la nevoie)
+        if (!m_intervals_dirty) {
+            m_intervals.PushBack(appointment.GetTimeSlot());
+            if (_CountsTowardUtilization(appointment)) {
+                m_utilization.AddBooking(appointment.GetEmployee(), appointment.GetTimeSlot());
             }
         }
         
@@ -130,6 +310,12 @@ namespace Beauty_Salon {
         // Gasim un angajat disponibil
         Employee* employee = _FindAvailableEmployee(service->GetType(), timeSlot);
         
+        // Cu ture definite, nu acceptam programari pe care nu le poate lua niciun angajat
+        if (!employee && m_roster && m_catalog) {
+            SALON_COUNT_REJECTION(NO_EMPLOYEE);
+            return false;
+        }
+        
         // Cream si adaugam o noua programare
         Appointment app(client, employee, service, timeSlot);
         return AddAppointment(app);
@@ -141,18 +327,35 @@ namespace Beauty_Salon {
         return AddAppointment(app);
     }
     
+    void Schedule::LoadAppointments(std::vector<Appointment> appointments) {
+        size_t first = m_appointments.size();
+        if (m_appointments.empty()) {
+            m_appointments = std::move(appointments);
+        } else {
+            m_appointments.insert(m_appointments.end(), std::make_move_iterator(appointments.begin()),
+                                  std::make_move_iterator(appointments.end()));
+        }
+        if (m_consumption_sink) {
+            for (size_t i = first; i < m_appointments.size(); ++i) {
+                if (!m_appointments[i].GetConsumptionSink()) {
+                    m_appointments[i].SetConsumptionSink(m_consumption_sink);
+                }
+            }
+        }
+        m_intervals_dirty = true;
+    }
+    
     bool Schedule::RemoveAppointment(int id) {
+        SALON_MEASURE(SCHEDULE_REMOVE);
         for (auto it = m_appointments.begin(); it != m_appointments.end(); ++it) {
             if (it->GetID() == id) {
-                // Actualizam incarcarea angajatului
-                if (it->GetEmployee()) {
-                    int employeeId = it->GetEmployee()->GetID();
-                    if (m_employee_load[employeeId] > 0) {
-                        m_employee_load[employeeId]--;
+                // Stergem programarea si actualizam incarcarea angajatului
+                if (!m_intervals_dirty) {
+                    m_intervals.Erase(static_cast<size_t>(it - m_appointments.begin()));
+                    if (_CountsTowardUtilization(*it)) {
+                        m_utilization.RemoveBooking(it->GetEmployee(), it->GetTimeSlot());
                     }
                 }
-                
-                // Stergem programarea
                 m_appointments.erase(it);
                 return true;
             }
@@ -176,33 +379,105 @@ namespace Beauty_Salon {
             return false;
         }
         
-        // Actualizam incarcarea angajatului vechi
-        if (app->GetEmployee()) {
-            int oldEmployeeId = app->GetEmployee()->GetID();
-            if (m_employee_load[oldEmployeeId] > 0) {
-                m_employee_load[oldEmployeeId]--;
-            }
+        // Si tura se verifica inainte de stergere, altfel AddAppointment ar refuza dupa ce programarea veche a disparut
+        if (newData.GetEmployee() && !_IsOnShift(newData.GetEmployee(), newData.GetTimeSlot())) {
+            return false;
         }
         
-        // Stergeti programarea veche si adaugati-o pe cea noua
+        // Stergeti programarea veche si adaugati-o pe cea noua (RemoveAppointment actualizeaza si incarcarea angajatului)
         RemoveAppointment(id);
         return AddAppointment(newData);
     }
     
+    size_t Schedule::_IndexOf(int id) const {
+        for (size_t i = 0; i < m_appointments.size(); ++i) {
+            if (m_appointments[i].GetID() == id) {
+                return i;
+            }
+        }
+        return m_appointments.size();
+    }
+    
+    bool Schedule::RescheduleAppointment(int id, const TimeSlot& newSlot) {
+        // Cautam fara FindAppointment, ca intervalele sa nu fie marcate pentru reconstruire
+        size_t index = _IndexOf(id);
+        if (index == m_appointments.size() || !m_appointments[index].CanReschedule()) {
+            return false;
+        }
+        
+        // Programarea veche nu trebuie sa blocheze noul interval, deci o scoatem inainte de verificare.
+        // Reschedule readuce o programare anulata la SCHEDULED
+        Appointment original = m_appointments[index];
+        Appointment moved = original;
+        moved.Reschedule(newSlot);
+        RemoveAppointment(id);
+        if (AddAppointment(moved)) {
+            return true;
+        }
+        
+        // Programarea veche era deja acceptata: o refacem fara sa o verificam din nou (turele sau capacitatea
+        // s-ar fi putut schimba intre timp)
+        _RestoreAt(index, original);
+        return false;
+    }
+    
+    void Schedule::_RestoreAt(size_t index, const Appointment& appointment) {
+        m_appointments.insert(m_appointments.begin() + static_cast<std::ptrdiff_t>(index), appointment);
+        if (!m_intervals_dirty) {
+            m_intervals.Insert(index, appointment.GetTimeSlot());
+            if (_CountsTowardUtilization(appointment)) {
+                m_utilization.AddBooking(appointment.GetEmployee(), appointment.GetTimeSlot());
+            }
+        }
+    }
+    
+    bool Schedule::CancelAppointment(int id) {
+        size_t index = _IndexOf(id);
+        if (index == m_appointments.size() || !m_appointments[index].Cancel()) {
+            return false;
+        }
+        
+        // Intervalul ramane in lista (ca la reconstruire), dar angajatul nu mai este ocupat
+        if (!m_intervals_dirty && m_appointments[index].GetEmployee()) {
+            m_utilization.RemoveBooking(m_appointments[index].GetEmployee(), m_appointments[index].GetTimeSlot());
+        }
+        return true;
+    }
+    
+    bool Schedule::CompleteAppointment(int id) {
+        size_t index = _IndexOf(id);
+        if (index == m_appointments.size()) {
+            return false;
+        }
+        return m_discounts ? m_appointments[index].Complete(*m_discounts) : m_appointments[index].Complete();
+    }
+    
+    bool Schedule::MarkNoShow(int id) {
+        size_t index = _IndexOf(id);
+        return index != m_appointments.size() && m_appointments[index].MarkNoShow();
+    }
+    
     Appointment* Schedule::FindAppointment(int id) {
+        SALON_MEASURE(SCHEDULE_FIND);
         for (auto& app : m_appointments) {
             if (app.GetID() == id) {
+                // Apelantul poate reprograma prin pointer, deci intervalele trebuie recalculate
+                m_intervals_dirty = true;
                 return &app;
             }
         }
         return nullptr;
     }
     
+    const std::vector<Appointment>& Schedule::GetAppointments() const {
+        return m_appointments;
+    }
+    
     // Metode de interogare
     std::vector<Appointment> Schedule::GetAppointmentsByDate(int date) const {
         std::vector<Appointment> result;
         for (const auto& app : m_appointments) {
-            if (app.GetTimeSlot().hour == date) {
+            if (app.GetTimeSlot().GetHour() == date) {
                 result.push_back(app);
             }
         }
@@ -230,7 +505,37 @@ namespace Beauty_Salon {
     }
     
     // Algoritm de optimizare a programului
+    std::vector<TimeSlot> Schedule::FindEarliestSlots(const Service* service, int firstDay, int dayCount, size_t maxCount) const {
+        SALON_MEASURE(SCHEDULE_SUGGEST);
+        std::vector<TimeSlot> result;
+        if (!service || maxCount == 0) {
+            return result;
+        }
+        
+        // Verificam zilele pe rand, ca sa ne oprim dupa primele maxCount intervale
+        int serviceDuration = service->GetDuration();
+        int lastStart = m_working_end_hour * 60 - serviceDuration;
+        std::vector<TimeSlot> daySlots;
+        for (int day = firstDay; day < firstDay + dayCount; ++day) {
+            daySlots.clear();
+            for (int start = m_working_start_hour * 60; start <= lastStart; start += 15) {
+                daySlots.push_back(TimeSlot::FromMinutes(day, start, serviceDuration));
+            }
+            
+            _FilterAvailableSlots(service, daySlots);
+            for (const TimeSlot& slot : daySlots) {
+                result.push_back(slot);
+                if (result.size() == maxCount) {
+                    return result;
+                }
+            }
+        }
+        return result;
+    }
+    
     std::vector<TimeSlot> Schedule::SuggestTimeSlots(const Client& client, Service* service, int preferredDate) const {
+        SALON_MEASURE(SCHEDULE_SUGGEST);
+        
         // Gasim toate intervalele disponibile
         std::vector<TimeSlot> availableSlots = _GetAvailableTimeSlots(preferredDate, service);
         
@@ -238,7 +543,7 @@ namespace Beauty_Salon {
         if (preferredDate > 0) {
             std::sort(availableSlots.begin(), availableSlots.end(), 
                 [preferredDate](const TimeSlot& a, const TimeSlot& b) {
-                    return std::abs(a.hour - preferredDate) < std::abs(b.hour - preferredDate);
+                    return std::abs(a.GetHour() - preferredDate) < std::abs(b.GetHour() - preferredDate);
                 });
         }
         
@@ -252,69 +557,128 @@ namespace Beauty_Salon {
     }
     
     // Rapoarte si statistici
-    void Schedule::GenerateDailyReport(int date) const {
-        std::vector<Appointment> dailyApps = GetAppointmentsByDate(date);
-        
-        std::cout << "=== Daily Report for Hour " << date << " ===" << std::endl;
-        std::cout << "Total Appointments: " << dailyApps.size() << std::endl;
-        std::cout << "Total Revenue: $" << CalculateDailyRevenue(date) << std::endl;
+    DailyReport Schedule::BuildDailyReport(int date) const {
+        SALON_MEASURE(SCHEDULE_REPORT);
+        DailyReport report;
+        report.date = date;
         
         // Numarul de programari per tip de serviciu
         std::map<std::string, int> serviceCount;
-        for (const auto& app : dailyApps) {
+        for (const auto& app : m_appointments) {
+            if (app.GetTimeSlot().GetHour() != date) {
+                continue;
+            }
+            report.totalAppointments++;
+            report.status.Add(app.GetStatus());
+            // Includem in venit doar programarile completate
+            if (app.GetStatus() == AppointmentStatus::COMPLETED) {
+                report.totalRevenue += app.GetTotalPrice();
+            }
             if (app.GetService()) {
                 serviceCount[app.GetService()->GetName()]++;
             }
         }
         
-        std::cout << "Services breakdown:" << std::endl;
-        for (const auto& pair : serviceCount) {
-            std::cout << " - " << pair.first << ": " << pair.second << std::endl;
+        report.services.assign(serviceCount.begin(), serviceCount.end());
+        return report;
+    }
+    
+    EmployeeReport Schedule::BuildEmployeeReport(const Employee& employee) const {
+        return BuildEmployeeReports(std::vector<const Employee*>(1, &employee)).front();
+    }
+    
+    std::vector<EmployeeReport> Schedule::BuildEmployeeReports(const std::vector<const Employee*>& employees) const {
+        SALON_MEASURE(SCHEDULE_REPORT);
+        std::vector<EmployeeReport> reports(employees.size());
+        std::unordered_map<int, size_t> indexById;
+        indexById.reserve(employees.size());
+        for (size_t i = 0; i < employees.size(); ++i) {
+            reports[i].employeeId = employees[i]->GetID();
+            reports[i].employeeName = employees[i]->GetName();
+            indexById[employees[i]->GetID()] = i;
         }
         
-        // Status programari
-        int scheduled = 0, inProgress = 0, completed = 0, cancelled = 0, noShow = 0;
-        for (const auto& app : dailyApps) {
-            switch (app.GetStatus()) {
-                case AppointmentStatus::SCHEDULED: scheduled++; break;
-                case AppointmentStatus::IN_PROGRESS: inProgress++; break;
-                case AppointmentStatus::COMPLETED: completed++; break;
-                case AppointmentStatus::CANCELLED: cancelled++; break;
-                case AppointmentStatus::NO_SHOW: noShow++; break;
+        // O singura trecere prin programari pentru toti angajatii. Programarile sunt impartite in blocuri fixe,
+        // fiecare bloc avand totalurile lui; blocurile sunt adunate in ordine, deci rezultatul nu depinde de numarul de fire
+        struct Totals {
+            int appointments = 0;
+            double revenue = 0.0;
+            int minutes = 0;
+        };
+        size_t blockCount = (m_appointments.size() + APPOINTMENTS_PER_TASK - 1) / APPOINTMENTS_PER_TASK;
+        std::vector<std::vector<Totals>> blockTotals(blockCount, std::vector<Totals>(employees.size()));
+        
+        _GetTaskPool().ParallelFor(0, blockCount, 1, [&](size_t firstBlock, size_t lastBlock) {
+            for (size_t block = firstBlock; block < lastBlock; ++block) {
+                std::vector<Totals>& totals = blockTotals[block];
+                size_t end = std::min(m_appointments.size(), (block + 1) * APPOINTMENTS_PER_TASK);
+                for (size_t i = block * APPOINTMENTS_PER_TASK; i < end; ++i) {
+                    const Appointment& app = m_appointments[i];
+                    if (!app.GetEmployee()) {
+                        continue;
+                    }
+                    auto it = indexById.find(app.GetEmployee()->GetID());
+                    if (it == indexById.end()) {
+                        continue;
+                    }
+                    Totals& total = totals[it->second];
+                    total.appointments++;
+                    total.revenue += app.GetTotalPrice();
+                    total.minutes += app.GetTimeSlot().GetDuration();
+                }
+            }
+        });
+        
+        for (const auto& totals : blockTotals) {
+            for (size_t i = 0; i < employees.size(); ++i) {
+                reports[i].totalAppointments += totals[i].appointments;
+                reports[i].totalRevenue += totals[i].revenue;
+                reports[i].totalMinutes += totals[i].minutes;
             }
         }
         
-        std::cout << "Status breakdown:" << std::endl;
-        std::cout << " - Scheduled: " << scheduled << std::endl;
-        std::cout << " - In Progress: " << inProgress << std::endl;
-        std::cout << " - Completed: " << completed << std::endl;
-        std::cout << " - Cancelled: " << cancelled << std::endl;
-        std::cout << " - No Show: " << noShow << std::endl;
+        return reports;
     }
     
-    void Schedule::GenerateEmployeeReport(const Employee& employee) const {
-        std::vector<Appointment> empApps = GetAppointmentsByEmployee(employee);
+    ScheduleReport Schedule::BuildScheduleReport(int date) const {
+        SALON_MEASURE(SCHEDULE_REPORT);
+        ScheduleReport report;
+        report.date = date;
         
-        std::cout << "=== Employee Report for " << employee.GetName() << " ===" << std::endl;
-        std::cout << "Total Appointments: " << empApps.size() << std::endl;
-        
-        // Calculam veniturile generate de angajat
-        double totalRevenue = 0.0;
-        for (const auto& app : empApps) {
-            totalRevenue += app.GetTotalPrice();
-        }
-        
-        std::cout << "Total Revenue Generated: $" << totalRevenue << std::endl;
-        
-        // Calculam timpul total lucrat (în minute)
-        int totalMinutes = 0;
-        for (const auto& app : empApps) {
-            totalMinutes += app.GetTimeSlot().duration;
+        for (const auto& app : m_appointments) {
+            if (app.GetTimeSlot().GetHour() != date) {
+                continue;
+            }
+            ScheduleEntry entry;
+            entry.appointmentId = app.GetID();
+            entry.clientName = app.GetClient().GetName();
+            if (app.GetService()) {
+                entry.serviceName = app.GetService()->GetName();
+            }
+            entry.timeSlot = app.GetTimeSlot();
+            entry.status = app.GetStatus();
+            entry.totalPrice = app.GetTotalPrice();
+            report.entries.push_back(entry);
         }
         
-        std::cout << "Total Working Time: " 
-                 << (totalMinutes / 60) << " hours and " 
-                 << (totalMinutes % 60) << " minutes" << std::endl;
+        // Sortam programarile dupa ora
+        std::sort(report.entries.begin(), report.entries.end(), 
+            [](const ScheduleEntry& a, const ScheduleEntry& b) {
+                return a.timeSlot < b.timeSlot;
+            });
+        return report;
+    }
+    
+    void Schedule::GenerateDailyReport(int date) const {
+        ReportWriter writer(ReportFormat::TEXT);
+        writer.Write(BuildDailyReport(date));
+        writer.FlushTo(std::cout);
+    }
+    
+    void Schedule::GenerateEmployeeReport(const Employee& employee) const {
+        ReportWriter writer(ReportFormat::TEXT);
+        writer.Write(BuildEmployeeReport(employee));
+        writer.FlushTo(std::cout);
     }
     
     double Schedule::CalculateDailyRevenue(int date) const {
@@ -331,47 +695,87 @@ namespace Beauty_Salon {
         return total;
     }
     
-    // Afisare informatii
-    void Schedule::DisplayDailySchedule(int date) const {
-        std::vector<Appointment> dailyApps = GetAppointmentsByDate(date);
+    double Schedule::QuoteDailyPrices(int date) const {
+        if (m_discounts) {
+            std::vector<LineItem> items;
+            for (const auto& app : m_appointments) {
+                if (app.GetService() && app.GetTimeSlot().GetHour() == date) {
+                    items.push_back(MakeLineItem(app));
+                }
+            }
+            return m_discounts->EvaluateBatch(items, nullptr);
+        }
         
-        // Sortam programarile dupa ora
+        std::vector<PriceQuoteLine> lines;
+        for (const auto& app : m_appointments) {
+            if (app.GetService() && app.GetTimeSlot().GetHour() == date) {
+                lines.push_back(PriceQuoteLine{&app.GetService()->GetPriceRecord(), app.GetClient().GetDiscountRate()});
+            }
+        }
+        return PricingEngine::QuoteBatch(lines.data(), lines.size(), nullptr);
+    }
+    
+    // Afisare informatii
+    void Schedule::RenderDailySchedule(TextBuffer& out, int date) const {
+        // Sortam pointeri catre programarile zilei dupa ora, fara a copia programarile
+        std::vector<const Appointment*> dailyApps;
+        for (const auto& app : m_appointments) {
+            if (app.GetTimeSlot().GetHour() == date) {
+                dailyApps.push_back(&app);
+            }
+        }
         std::sort(dailyApps.begin(), dailyApps.end(), 
-            [](const Appointment& a, const Appointment& b) {
-                int timeA = a.GetTimeSlot().hour * 60 + a.GetTimeSlot().minute;
-                int timeB = b.GetTimeSlot().hour * 60 + b.GetTimeSlot().minute;
-                return timeA < timeB;
+            [](const Appointment* a, const Appointment* b) {
+                return a->GetTimeSlot() < b->GetTimeSlot();
             });
         
-        std::cout << "=== Schedule for Hour " << date << " ===" << std::endl;
+        out.Append("=== Schedule for Hour ").AppendInteger(date).Append(" ===\n");
         
         if (dailyApps.empty()) {
-            std::cout << "No appointments scheduled." << std::endl;
+            out.Append("No appointments scheduled.\n");
             return;
         }
         
-        for (const auto& app : dailyApps) {
-            std::cout << app << std::endl;
+        for (const Appointment* app : dailyApps) {
+            app->FormatTo(out);
+            out.Append('\n');
         }
     }
     
-    void Schedule::DisplayAllAppointments() const {
+    void Schedule::RenderAllAppointments(TextBuffer& out) const {
         if (m_appointments.empty()) {
-            std::cout << "No appointments scheduled." << std::endl;
+            out.Append("No appointments scheduled.\n");
             return;
         }
         
-        // Sortam programarile dupa ID
-        std::vector<Appointment> sortedApps = m_appointments;
+        // Sortam pointeri catre programari dupa ID
+        std::vector<const Appointment*> sortedApps;
+        sortedApps.reserve(m_appointments.size());
+        for (const auto& app : m_appointments) {
+            sortedApps.push_back(&app);
+        }
         std::sort(sortedApps.begin(), sortedApps.end(), 
-            [](const Appointment& a, const Appointment& b) {
-                return a.GetID() < b.GetID();
+            [](const Appointment* a, const Appointment* b) {
+                return a->GetID() < b->GetID();
             });
         
-        std::cout << "=== All Appointments ===" << std::endl;
+        out.Append("=== All Appointments ===\n");
         
-        for (const auto& app : sortedApps) {
-            std::cout << app << std::endl;
+        for (const Appointment* app : sortedApps) {
+            app->FormatTo(out);
+            out.Append('\n');
         }
     }
+    
+    void Schedule::DisplayDailySchedule(int date) const {
+        TextBuffer buffer;
+        RenderDailySchedule(buffer, date);
+        buffer.WriteTo(std::cout);
+    }
+    
+    void Schedule::DisplayAllAppointments() const {
+        TextBuffer buffer;
+        RenderAllAppointments(buffer);
+        buffer.WriteTo(std::cout);
+    }
 }
@@ -1,4 +1,5 @@
 #include "service.h"
+#include "service_definitions.h"
 #include <vector>
 
 namespace Beauty_Salon {
@@ -10,37 +11,58 @@ namespace Beauty_Salon {
     }
     
     // Metode protejate
+    void Service::_Touch() {
+        m_version++;
+        PriceEpoch::Advance();
+    }
+    
     void Service::_UpdateDetails(const ServiceDetails& details) {
         m_details = details;
+        m_price_record.duration = details.duration;
+        _Touch();
+    }
+    
+    void Service::_SetType(ServiceType type) {
+        m_type = type;
+        m_price_record.type = type;
+    }
+    
+    void Service::_CompilePriceRecord(double multiplier, double surcharge) {
+        m_price_record = PriceRecord(m_base_price, multiplier, surcharge, m_details.duration, m_type);
+        _Touch();
     }
     
     // Implementarile constructorilor
     Service::Service() 
         : m_name("Unnamed Service"), m_base_price(0.0), 
-          m_details(ServiceDetails()), m_type(ServiceType::OTHER) {
+          m_details(ServiceDetails()), m_type(ServiceType::OTHER),
+          m_price_record(m_base_price, 1.0, 0.0, m_details.duration, m_type), m_version(0) {
     }
     
     Service::Service(std::string name, double basePrice) 
         : m_name(name), m_base_price(basePrice), 
-          m_details(ServiceDetails()), m_type(ServiceType::OTHER) {
+          m_details(ServiceDetails()), m_type(ServiceType::OTHER),
+          m_price_record(m_base_price, 1.0, 0.0, m_details.duration, m_type), m_version(0) {
     }
     
     Service::Service(std::string name, double basePrice, int durationMinutes) 
         : m_name(name), m_base_price(basePrice), 
           m_details(ServiceDetails(durationMinutes, "", false)), 
-          m_type(ServiceType::OTHER) {
+          m_type(ServiceType::OTHER),
+          m_price_record(m_base_price, 1.0, 0.0, m_details.duration, m_type), m_version(0) {
     }
     
     Service::Service(std::string name, double basePrice, const ServiceDetails& details) 
         : m_name(name), m_base_price(basePrice), 
-          m_details(details), m_type(ServiceType::OTHER) {
+          m_details(details), m_type(ServiceType::OTHER),
+          m_price_record(m_base_price, 1.0, 0.0, m_details.duration, m_type), m_version(0) {
     }
     
     Service::~Service() {
     }
     
     // Getteri
-    std::string Service::GetName() const {
+    const std::string& Service::GetName() const {
         return m_name;
     }
     
@@ -73,38 +95,59 @@ namespace Beauty_Salon {
     
     // Implementarea metodelor virtuale
     void Service::DisplayInfo() const {
-        std::cout << "Service: " << m_name << std::endl;
-        std::cout << "Base Price: $" << m_base_price << std::endl;
-        std::cout << "Duration: " << m_details.duration << " minutes" << std::endl;
+        std::cout << "Service: " << m_name << "\n";
+        std::cout << "Base Price: $" << m_base_price << "\n";
+        std::cout << "Duration: " << m_details.duration << " minutes" << "\n";
         if (!m_details.roomNeeded.empty()) {
-            std::cout << "Required Room: " << m_details.roomNeeded << std::endl;
+            std::cout << "Required Room: " << m_details.roomNeeded << "\n";
         }
     }
     
+    void Service::FormatTo(TextBuffer& out) const {
+        out.Append("Service: ").Append(m_name)
+           .Append(" - $").AppendPrice(m_base_price)
+           .Append(" (").AppendInteger(m_details.duration).Append(" min)");
+    }
+    
     // Supraincarcare operator pentru afisare
     std::ostream& operator<<(std::ostream& os, const Service& service) {
-        os << "Service: " << service.m_name 
-           << " - $" << service.m_base_price 
-           << " (" << service.m_details.duration << " min)";
+        TextBuffer buffer;
+        service.FormatTo(buffer);
+        buffer.WriteTo(os);
         return os;
     }
     
+    void RenderServiceList(TextBuffer& out, const std::vector<std::unique_ptr<Service>>& services) {
+        for (size_t i = 0; i < services.size(); ++i) {
+            out.AppendInteger(static_cast<long long>(i + 1)).Append(". ");
+            services[i]->FormatTo(out);
+            out.Append('\n');
+        }
+    }
+    
     // Implementari HairService
     HairService::HairService() 
         : Service(), m_includes_washing(false), m_includes_styling(false) {
+        _SetType(ServiceType::HAIR_CUT);
+        _RecompilePrice();
     }
     
     HairService::HairService(std::string name, double basePrice) 
         : Service(name, basePrice), m_includes_washing(false), m_includes_styling(false) {
+        _SetType(ServiceType::HAIR_CUT);
         _UpdateDetails(ServiceDetails(30, "Hair Station", false));
+        _RecompilePrice();
     }
     
     HairService::HairService(std::string name, double basePrice, bool washing, bool styling) 
+        : HairService(name, basePrice, washing, styling, ServiceType::HAIR_CUT) {
+    }
+    
+    HairService::HairService(std::string name, double basePrice, bool washing, bool styling, ServiceType type) 
         : Service(name, basePrice), m_includes_washing(washing), m_includes_styling(styling) {
-        int duration = 30; 
-        if (washing) duration += 15;
-        if (styling) duration += 20;
-        _UpdateDetails(ServiceDetails(duration, "Hair Station", false));
+        _SetType(type == ServiceType::HAIR_COLOR ? ServiceType::HAIR_COLOR : ServiceType::HAIR_CUT);
+        _UpdateDetails(ServiceDetails(ServiceRules::HairDuration(washing, styling), "Hair Station", false));
+        _RecompilePrice();
     }
     
     void HairService::SetIncludesWashing(bool includes) {
@@ -113,6 +156,7 @@ namespace Beauty_Salon {
         ServiceDetails details = GetDetails();
         details.duration += includes ? 15 : -15;
         _UpdateDetails(details);
+        _RecompilePrice();
     }
     
     void HairService::SetIncludesStyling(bool includes) {
@@ -121,6 +165,7 @@ namespace Beauty_Salon {
         ServiceDetails details = GetDetails();
         details.duration += includes ? 20 : -20;
         _UpdateDetails(details);
+        _RecompilePrice();
     }
     
     bool HairService::IncludesWashing() const {
@@ -131,11 +176,12 @@ namespace Beauty_Salon {
         return m_includes_styling;
     }
     
+    void HairService::_RecompilePrice() {
+        _CompilePriceRecord(1.0, ServiceRules::HairSurcharge(m_includes_washing, m_includes_styling));
+    }
+    
     double HairService::CalculatePrice() {
-        double price = GetBasePrice();
-        if (m_includes_washing) price += 10.0;
-        if (m_includes_styling) price += 15.0;
-        return price;
+        return GetPriceRecord().price;
     }
     
     int HairService::EstimateTime() {
@@ -145,40 +191,43 @@ namespace Beauty_Salon {
     
     void HairService::DisplayInfo() const {
         Service::DisplayInfo();
-        std::cout << "Includes Washing: " << (m_includes_washing ? "Yes" : "No") << std::endl;
-        std::cout << "Includes Styling: " << (m_includes_styling ? "Yes" : "No") << std::endl;
+        std::cout << "Includes Washing: " << (m_includes_washing ? "Yes" : "No") << "\n";
+        std::cout << "Includes Styling: " << (m_includes_styling ? "Yes" : "No") << "\n";
     }
     
     // Implementari NailService
     NailService::NailService() 
         : Service(), m_is_gel(false), m_nail_count(10) {
+        _SetType(ServiceType::MANICURE);
+        _RecompilePrice();
     }
     
     NailService::NailService(std::string name, double basePrice) 
         : Service(name, basePrice), m_is_gel(false), m_nail_count(10) {
+        _SetType(ServiceType::MANICURE);
         _UpdateDetails(ServiceDetails(45, "Nail Station", false));
+        _RecompilePrice();
     }
     
     NailService::NailService(std::string name, double basePrice, bool isGel, int nailCount) 
+        : NailService(name, basePrice, isGel, nailCount, ServiceType::MANICURE) {
+    }
+    
+    NailService::NailService(std::string name, double basePrice, bool isGel, int nailCount, ServiceType type) 
         : Service(name, basePrice), m_is_gel(isGel), m_nail_count(nailCount) {
-        int duration = isGel ? 60 : 45; // gel dureaza mai mult
-        // Ajustam pentru mai putine unghii (daca e cazul)
-        if (nailCount < 10) {
-            duration = static_cast<int>(duration * (nailCount / 10.0));
-        }
-        _UpdateDetails(ServiceDetails(duration, "Nail Station", false));
+        _SetType(type == ServiceType::PEDICURE ? ServiceType::PEDICURE : ServiceType::MANICURE);
+        // Gel-ul dureaza mai mult; durata scade pentru mai putine unghii
+        _UpdateDetails(ServiceDetails(ServiceRules::NailDuration(isGel, nailCount), "Nail Station", false));
+        _RecompilePrice();
     }
     
     void NailService::SetIsGel(bool isGel) {
         m_is_gel = isGel;
         // Actualizam durata
         ServiceDetails details = GetDetails();
-        details.duration = isGel ? 60 : 45;
-        // Ajustam pentru numarul de unghii
-        if (m_nail_count < 10) {
-            details.duration = static_cast<int>(details.duration * (m_nail_count / 10.0));
-        }
+        details.duration = ServiceRules::NailDuration(isGel, m_nail_count);
         _UpdateDetails(details);
+        _RecompilePrice();
     }
     
     void NailService::SetNailCount(int count) {
@@ -188,6 +237,7 @@ namespace Beauty_Salon {
         double baseDuration = m_is_gel ? 60.0 : 45.0;
         details.duration = static_cast<int>(baseDuration * (count / 10.0));
         _UpdateDetails(details);
+        _RecompilePrice();
     }
     
     bool NailService::IsGel() const {
@@ -198,14 +248,12 @@ namespace Beauty_Salon {
         return m_nail_count;
     }
     
+    void NailService::_RecompilePrice() {
+        _CompilePriceRecord(ServiceRules::NailMultiplier(m_is_gel, m_nail_count), 0.0);
+    }
+    
     double NailService::CalculatePrice() {
-        double price = GetBasePrice();
-        if (m_is_gel) price *= 1.5; // gel costa mai mult
-        // Ajustam pentru mai putine unghii (daca e cazul)
-        if (m_nail_count < 10) {
-            price = price * (m_nail_count / 10.0);
-        }
-        return price;
+        return GetPriceRecord().price;
     }
     
     int NailService::EstimateTime() {
@@ -215,36 +263,46 @@ namespace Beauty_Salon {
     
     void NailService::DisplayInfo() const {
         Service::DisplayInfo();
-        std::cout << "Gel Service: " << (m_is_gel ? "Yes" : "No") << std::endl;
-        std::cout << "Nail Count: " << m_nail_count << std::endl;
+        std::cout << "Gel Service: " << (m_is_gel ? "Yes" : "No") << "\n";
+        std::cout << "Nail Count: " << m_nail_count << "\n";
     }
     
     // Implementari SpaService
     SpaService::SpaService() 
         : Service(), m_is_premium(false), m_requires_special_room(false) {
+        _SetType(ServiceType::MASSAGE);
+        _RecompilePrice();
     }
     
     SpaService::SpaService(std::string name, double basePrice) 
         : Service(name, basePrice), m_is_premium(false), m_requires_special_room(false) {
+        _SetType(ServiceType::MASSAGE);
         _UpdateDetails(ServiceDetails(60, "Spa Room", true));
+        _RecompilePrice();
     }
     
     SpaService::SpaService(std::string name, double basePrice, bool isPremium, bool requiresSpecialRoom) 
+        : SpaService(name, basePrice, isPremium, requiresSpecialRoom, ServiceType::MASSAGE) {
+    }
+    
+    SpaService::SpaService(std::string name, double basePrice, bool isPremium, bool requiresSpecialRoom, ServiceType type) 
         : Service(name, basePrice), m_is_premium(isPremium), m_requires_special_room(requiresSpecialRoom) {
+        _SetType(type == ServiceType::FACIAL ? ServiceType::FACIAL : ServiceType::MASSAGE);
         std::string room = requiresSpecialRoom ? "Premium Spa Room" : "Spa Room";
-        int duration = isPremium ? 90 : 60;
-        _UpdateDetails(ServiceDetails(duration, room, true));
+        _UpdateDetails(ServiceDetails(ServiceRules::SpaDuration(isPremium), room, true));
+        _RecompilePrice();
     }
     
     void SpaService::SetIsPremium(bool isPremium) {
         m_is_premium = isPremium;
         // Actualizam durata și camera
         ServiceDetails details = GetDetails();
-        details.duration = isPremium ? 90 : 60;
+        details.duration = ServiceRules::SpaDuration(isPremium);
         if (m_requires_special_room) {
             details.roomNeeded = "Premium Spa Room";
         }
         _UpdateDetails(details);
+        _RecompilePrice();
     }
     
     void SpaService::SetRequiresSpecialRoom(bool requires) {
@@ -253,6 +311,7 @@ namespace Beauty_Salon {
         ServiceDetails details = GetDetails();
         details.roomNeeded = requires ? "Premium Spa Room" : "Spa Room";
         _UpdateDetails(details);
+        _RecompilePrice();
     }
     
     bool SpaService::IsPremium() const {
@@ -263,11 +322,13 @@ namespace Beauty_Salon {
         return m_requires_special_room;
     }
     
+    void SpaService::_RecompilePrice() {
+        // Premium costa mai mult, iar camera speciala are cost suplimentar
+        _CompilePriceRecord(ServiceRules::SpaMultiplier(m_is_premium), ServiceRules::SpaSurcharge(m_requires_special_room));
+    }
+    
     double SpaService::CalculatePrice() {
-        double price = GetBasePrice();
-        if (m_is_premium) price *= 1.75; // premium costa mai mult
-        if (m_requires_special_room) price += 30.0; // camera speciala are cost suplimentar
-        return price;
+        return GetPriceRecord().price;
     }
     
     int SpaService::EstimateTime() {
@@ -277,8 +338,8 @@ namespace Beauty_Salon {
     
     void SpaService::DisplayInfo() const {
         Service::DisplayInfo();
-        std::cout << "Premium Service: " << (m_is_premium ? "Yes" : "No") << std::endl;
-        std::cout << "Special Room Required: " << (m_requires_special_room ? "Yes" : "No") << std::endl;
+        std::cout << "Premium Service: " << (m_is_premium ? "Yes" : "No") << "\n";
+        std::cout << "Special Room Required: " << (m_requires_special_room ? "Yes" : "No") << "\n";
     }
     
     // Implementari ServicePackage
@@ -298,56 +359,102 @@ namespace Beauty_Salon {
         // Nu eliberam resursele aici deoarece nu detinem serviciile
     }
     
-    void ServicePackage::AddService(Service* service) {
-        m_services.push_back(service);
+    void ServicePackage::_RefreshTotals() const {
+        auto version = [this](size_t i) { return m_services[i]->GetVersion(); };
+        if (m_totals.IsValid(m_services.Size(), version)) {
+            return;
+        }
+        // Citim inregistrarile precompilate si aplicam discount-ul pachetului
+        double price = PricingEngine::QuotePackage(m_records.Data(), m_records.Size(), m_package_discount);
+        int minutes = PricingEngine::TotalDuration(m_records.Data(), m_records.Size());
+        m_totals.Store(price, minutes, m_services.Size(), version);
     }
     
-    double ServicePackage::CalculateTotalPrice() const {
-        double total = 0.0;
-        for (const auto& service : m_services) {
-            total += service->CalculatePrice();
+    void ServicePackage::AddService(const Service* service) {
+        if (service) {
+            m_services.PushBack(service);
+            m_records.PushBack(&service->GetPriceRecord());
+            m_totals.Invalidate();
         }
-        // Aplicam discount-ul pachetului
-        return total * (1.0 - m_package_discount / 100.0);
+    }
+    
+    size_t ServicePackage::GetServiceCount() const {
+        return m_services.Size();
+    }
+    
+    const Service* ServicePackage::GetService(size_t index) const {
+        return index < m_services.Size() ? m_services[index] : nullptr;
+    }
+    
+    const std::string& ServicePackage::GetName() const {
+        return m_name;
+    }
+    
+    double ServicePackage::GetPackageDiscount() const {
+        return m_package_discount;
+    }
+    
+    ServicePackage& ServicePackage::operator+=(const Service& service) {
+        AddService(&service);
+        return *this;
+    }
+    
+    double ServicePackage::CalculateTotalPrice() const {
+        _RefreshTotals();
+        return m_totals.GetPrice();
     }
     
     int ServicePackage::CalculateTotalTime() const {
-        int total = 0;
-        for (const auto& service : m_services) {
-            total += service->EstimateTime();
+        _RefreshTotals();
+        return m_totals.GetMinutes();
+    }
+    
+    PackageReport ServicePackage::BuildReport() const {
+        PackageReport report;
+        report.name = m_name;
+        report.discount = m_package_discount;
+        for (size_t i = 0; i < m_services.Size(); ++i) {
+            PackageItem item;
+            item.name = m_services[i]->GetName();
+            item.price = m_records[i]->price;
+            item.minutes = m_records[i]->duration;
+            report.items.push_back(item);
         }
-        return total;
+        report.totalPrice = CalculateTotalPrice();
+        report.totalMinutes = CalculateTotalTime();
+        return report;
     }
     
     void ServicePackage::DisplayPackageInfo() const {
-        std::cout << "Package: " << m_name << std::endl;
-        std::cout << "Discount: " << m_package_discount << "%" << std::endl;
-        std::cout << "Services included:" << std::endl;
-        
-        for (const auto& service : m_services) {
-            std::cout << " - " << service->GetName() 
-                     << " ($" << service->CalculatePrice() << ")" << std::endl;
-        }
-        
-        std::cout << "Total Price: $" << CalculateTotalPrice() << std::endl;
-        std::cout << "Total Duration: " << CalculateTotalTime() << " minutes" << std::endl;
+        ReportWriter writer(ReportFormat::TEXT);
+        writer.Write(BuildReport());
+        writer.FlushTo(std::cout);
     }
     
     std::ostream& operator<<(std::ostream& os, const ServicePackage& package) {
         os << "Package: " << package.m_name << " - $" << package.CalculateTotalPrice() 
            << " (" << package.CalculateTotalTime() << " min, " 
-           << package.m_services.size() << " services)";
+           << package.m_services.Size() << " services)";
         return os;
     }
     
     // Operatorul + pentru servicii
     ServicePackage operator+(const Service& lhs, const Service& rhs) {
         ServicePackage package("Custom Package");
-        // Hack temporar: copiem serviciile pentru a le adăuga în pachet
-        Service* lhsCopy = const_cast<Service*>(&lhs);
-        Service* rhsCopy = const_cast<Service*>(&rhs);
-        package.AddService(lhsCopy);
-        package.AddService(rhsCopy);
+        package.AddService(&lhs);
+        package.AddService(&rhs);
         return package;
     }
+    
+    ServicePackage operator+(ServicePackage&& package, const Service& service) {
+        // Pachetul temporar din stanga este refolosit, nu copiat
+        package += service;
+        return std::move(package);
+    }
+    
+    ServicePackage operator+(const ServicePackage& package, const Service& service) {
+        ServicePackage result(package);
+        result += service;
+        return result;
+    }
 }
@@ -0,0 +1,120 @@
+#include "service_catalog.h"
+
+namespace Beauty_Salon {
+    namespace {
+        // Listele goale intoarse cand nu exista rezultate
+        const std::vector<Service*> NO_SERVICES;
+        const std::vector<Employee*> NO_EMPLOYEES;
+    }
+    
+    ServiceCatalog::ServiceCatalog() {
+    }
+    
+    // Metode private
+    void ServiceCatalog::_IndexService(Service* service) {
+        m_by_type[static_cast<int>(service->GetType())].push_back(service);
+        m_by_room[service->GetDetails().roomNeeded].push_back(service);
+    }
+    
+    void ServiceCatalog::_BuildQualification(size_t index) {
+        m_matrix.FindQualified(ServiceTypeBit(m_services[index]->GetType()), m_qualified[index]);
+    }
+    
+    // Gestionarea serviciilor
+    Service* ServiceCatalog::AddService(std::unique_ptr<Service> service) {
+        if (!service || m_by_name.count(service->GetName())) {
+            return nullptr;
+        }
+        
+        Service* raw = service.get();
+        m_index_of[raw] = m_services.size();
+        m_by_name[raw->GetName()] = raw;
+        m_services.push_back(std::move(service));
+        _IndexService(raw);
+        
+        // Serviciile adaugate dupa BuildQualifications primesc si ele lista de angajati
+        m_qualified.emplace_back();
+        _BuildQualification(m_services.size() - 1);
+        return raw;
+    }
+    
+    size_t ServiceCatalog::GetServiceCount() const {
+        return m_services.size();
+    }
+    
+    Service* ServiceCatalog::GetService(size_t index) const {
+        return index < m_services.size() ? m_services[index].get() : nullptr;
+    }
+    
+    const std::vector<std::unique_ptr<Service>>& ServiceCatalog::GetServices() const {
+        return m_services;
+    }
+    
+    // Cautari
+    Service* ServiceCatalog::FindByName(const std::string& name) const {
+        auto it = m_by_name.find(name);
+        return it != m_by_name.end() ? it->second : nullptr;
+    }
+    
+    const std::vector<Service*>& ServiceCatalog::FindByType(ServiceType type) const {
+        return m_by_type[static_cast<int>(type)];
+    }
+    
+    const std::vector<Service*>& ServiceCatalog::FindByRoom(const std::string& room) const {
+        auto it = m_by_room.find(room);
+        return it != m_by_room.end() ? it->second : NO_SERVICES;
+    }
+    
+    // Calificari
+    void ServiceCatalog::BuildQualifications(const std::vector<std::unique_ptr<Employee>>& employees) {
+        std::vector<Employee*> raw;
+        raw.reserve(employees.size());
+        for (const auto& employee : employees) {
+            raw.push_back(employee.get());
+        }
+        BuildQualifications(raw);
+    }
+    
+    void ServiceCatalog::BuildQualifications(const std::vector<Employee*>& employees) {
+        m_employees = employees;
+        m_matrix.Build(m_employees);
+        
+        for (int type = 0; type < SERVICE_TYPE_COUNT; ++type) {
+            m_matrix.FindQualified(ServiceTypeBit(static_cast<ServiceType>(type)), m_qualified_by_type[type]);
+        }
+        
+        for (size_t i = 0; i < m_services.size(); ++i) {
+            _BuildQualification(i);
+        }
+    }
+    
+    const std::vector<Employee*>& ServiceCatalog::GetQualifiedEmployees(const Service* service) const {
+        auto it = m_index_of.find(service);
+        if (it == m_index_of.end()) {
+            return service ? GetQualifiedEmployees(service->GetType()) : NO_EMPLOYEES;
+        }
+        return m_qualified[it->second];
+    }
+    
+    const std::vector<Employee*>& ServiceCatalog::GetQualifiedEmployees(ServiceType type) const {
+        return m_qualified_by_type[static_cast<int>(type)];
+    }
+    
+    std::vector<Employee*> ServiceCatalog::GetQualifiedEmployees(ServiceTypeMask types) const {
+        return m_matrix.FindQualified(types);
+    }
+    
+    const QualificationMatrix& ServiceCatalog::GetQualificationMatrix() const {
+        return m_matrix;
+    }
+    
+    void ServiceCatalog::Reindex() {
+        for (auto& list : m_by_type) {
+            list.clear();
+        }
+        m_by_room.clear();
+        for (const auto& service : m_services) {
+            _IndexService(service.get());
+        }
+    }
+}
@@ -0,0 +1,228 @@
+#include "shift_calendar.h"
+#include <algorithm>
+
+namespace Beauty_Salon {
+    namespace {
+        // Interval nevid de minute din aceeasi zi
+        bool IsValidRange(int startMinute, int endMinute) {
+            return startMinute >= 0 && endMinute <= TimeSlot::MINUTES_PER_DAY && startMinute < endMinute;
+        }
+        
+        // Masca bitilor [from, to) dintr-un cuvant (0 <= from < to <= 64)
+        std::uint64_t WordMask(int from, int to) {
+            std::uint64_t high = to == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << to) - 1;
+            return high & ~((std::uint64_t(1) << from) - 1);
+        }
+        
+        // Ziua saptamanii si pentru zilele negative (% pastreaza semnul deimpartitului)
+        int WeekdayOf(int day) {
+            return ((day % DAYS_PER_WEEK) + DAYS_PER_WEEK) % DAYS_PER_WEEK;
+        }
+    }
+    
+    // Implementarea DayAvailability
+    DayAvailability::DayAvailability() {
+        Clear();
+    }
+    
+    void DayAvailability::Clear() {
+        std::fill(m_words, m_words + WORD_COUNT, 0);
+    }
+    
+    void DayAvailability::SetRange(int startMinute, int endMinute) {
+        if (!IsValidRange(startMinute, endMinute)) {
+            return;
+        }
+        for (int word = startMinute / 64; word * 64 < endMinute; ++word) {
+            int from = std::max(startMinute - word * 64, 0);
+            int to = std::min(endMinute - word * 64, 64);
+            m_words[word] |= WordMask(from, to);
+        }
+    }
+    
+    void DayAvailability::ClearRange(int startMinute, int endMinute) {
+        if (!IsValidRange(startMinute, endMinute)) {
+            return;
+        }
+        for (int word = startMinute / 64; word * 64 < endMinute; ++word) {
+            int from = std::max(startMinute - word * 64, 0);
+            int to = std::min(endMinute - word * 64, 64);
+            m_words[word] &= ~WordMask(from, to);
+        }
+    }
+    
+    bool DayAvailability::IsRangeSet(int startMinute, int endMinute) const {
+        if (!IsValidRange(startMinute, endMinute)) {
+            return false;
+        }
+        for (int word = startMinute / 64; word * 64 < endMinute; ++word) {
+            int from = std::max(startMinute - word * 64, 0);
+            int to = std::min(endMinute - word * 64, 64);
+            std::uint64_t mask = WordMask(from, to);
+            if ((m_words[word] & mask) != mask) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    int DayAvailability::CountMinutes() const {
+        int count = 0;
+        for (size_t i = 0; i < WORD_COUNT; ++i) {
+            count += __builtin_popcountll(m_words[i]);
+        }
+        return count;
+    }
+    
+    bool DayAvailability::IsEmpty() const {
+        for (size_t i = 0; i < WORD_COUNT; ++i) {
+            if (m_words[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    // Implementarea ShiftCalendar
+    ShiftCalendar::ShiftCalendar() {
+    }
+    
+    void ShiftCalendar::_Compile() {
+        for (int weekday = 0; weekday < DAYS_PER_WEEK; ++weekday) {
+            DayAvailability& mask = m_weekly[weekday];
+            mask.Clear();
+            for (const auto& shift : m_shifts[weekday]) {
+                mask.SetRange(shift.startMinute, shift.endMinute);
+            }
+            for (const auto& pause : m_breaks[weekday]) {
+                mask.ClearRange(pause.startMinute, pause.endMinute);
+            }
+        }
+        
+        // Absentele de zile intregi raman intervale; zilele cu absente partiale (cate o zi fiecare) pornesc
+        // de la tiparul saptamanal si scot intervalele absente
+        m_exceptions.clear();
+        m_days_off.clear();
+        for (const auto& off : m_time_off) {
+            if (off.minutes.startMinute == 0 && off.minutes.endMinute == TimeSlot::MINUTES_PER_DAY) {
+                m_days_off.emplace_back(off.firstDay, off.lastDay);
+                continue;
+            }
+            auto it = m_exceptions.find(off.firstDay);
+            if (it == m_exceptions.end()) {
+                it = m_exceptions.emplace(off.firstDay, m_weekly[WeekdayOf(off.firstDay)]).first;
+            }
+            it->second.ClearRange(off.minutes.startMinute, off.minutes.endMinute);
+        }
+    }
+    
+    bool ShiftCalendar::AddShift(int weekday, int startMinute, int endMinute) {
+        if (weekday < 0 || weekday >= DAYS_PER_WEEK || !IsValidRange(startMinute, endMinute)) {
+            return false;
+        }
+        m_shifts[weekday].push_back(MinuteRange{startMinute, endMinute});
+        _Compile();
+        return true;
+    }
+    
+    bool ShiftCalendar::AddBreak(int weekday, int startMinute, int endMinute) {
+        if (weekday < 0 || weekday >= DAYS_PER_WEEK || !IsValidRange(startMinute, endMinute)) {
+            return false;
+        }
+        m_breaks[weekday].push_back(MinuteRange{startMinute, endMinute});
+        _Compile();
+        return true;
+    }
+    
+    void ShiftCalendar::AddWeeklyShift(unsigned weekdays, int startMinute, int endMinute) {
+        if (!IsValidRange(startMinute, endMinute)) {
+            return;
+        }
+        for (int weekday = 0; weekday < DAYS_PER_WEEK; ++weekday) {
+            if (weekdays & (1u << weekday)) {
+                m_shifts[weekday].push_back(MinuteRange{startMinute, endMinute});
+            }
+        }
+        _Compile();
+    }
+    
+    bool ShiftCalendar::AddTimeOff(int firstDay, int lastDay, TimeOffReason reason) {
+        if (firstDay < 0 || lastDay < firstDay) {
+            return false;
+        }
+        m_time_off.push_back(TimeOff{firstDay, lastDay, MinuteRange{0, TimeSlot::MINUTES_PER_DAY}, reason});
+        _Compile();
+        return true;
+    }
+    
+    bool ShiftCalendar::AddTimeOff(int day, int startMinute, int endMinute, TimeOffReason reason) {
+        if (day < 0 || !IsValidRange(startMinute, endMinute)) {
+            return false;
+        }
+        m_time_off.push_back(TimeOff{day, day, MinuteRange{startMinute, endMinute}, reason});
+        _Compile();
+        return true;
+    }
+    
+    void ShiftCalendar::Clear() {
+        for (int weekday = 0; weekday < DAYS_PER_WEEK; ++weekday) {
+            m_shifts[weekday].clear();
+            m_breaks[weekday].clear();
+        }
+        m_time_off.clear();
+        _Compile();
+    }
+    
+    const DayAvailability& ShiftCalendar::GetDay(int day) const {
+        for (const auto& off : m_days_off) {
+            if (day >= off.first && day <= off.second) {
+                return m_day_off;
+            }
+        }
+        if (!m_exceptions.empty()) {
+            auto it = m_exceptions.find(day);
+            if (it != m_exceptions.end()) {
+                return it->second;
+            }
+        }
+        return m_weekly[WeekdayOf(day)];
+    }
+    
+    bool ShiftCalendar::IsAvailable(const TimeSlot& slot) const {
+        return GetDay(slot.GetDay()).IsRangeSet(slot.GetStartMinute(), slot.GetEndMinute());
+    }
+    
+    const std::vector<TimeOff>& ShiftCalendar::GetTimeOff() const {
+        return m_time_off;
+    }
+    
+    // Implementarea ShiftRoster
+    ShiftRoster::ShiftRoster() {
+    }
+    
+    ShiftCalendar& ShiftRoster::GetCalendar(const Employee& employee) {
+        size_t index = static_cast<size_t>(employee.GetID());
+        if (index >= m_calendars.size()) {
+            m_calendars.resize(index + 1);
+        }
+        if (!m_calendars[index]) {
+            m_calendars[index].reset(new ShiftCalendar());
+        }
+        return *m_calendars[index];
+    }
+    
+    const ShiftCalendar* ShiftRoster::FindCalendar(int employeeId) const {
+        if (employeeId < 0 || static_cast<size_t>(employeeId) >= m_calendars.size()) {
+            return nullptr;
+        }
+        return m_calendars[employeeId].get();
+    }
+    
+    bool ShiftRoster::IsAvailable(const Employee* employee, const TimeSlot& slot) const {
+        if (!employee) {
+            return true;
+        }
+        const ShiftCalendar* calendar = FindCalendar(employee->GetID());
+        return !calendar || calendar->IsAvailable(slot);
+    }
+}
@@ -0,0 +1,279 @@
+#include "task_pool.h"
+#include <chrono>
+
+namespace Beauty_Salon {
+    namespace {
+        // Pool-ul si indexul firului curent (setate doar pe firele unui pool)
+        thread_local const TaskPool* t_pool = nullptr;
+        thread_local int t_worker = -1;
+        
+        void UpdateMax(std::atomic<std::uint64_t>& target, std::uint64_t value) {
+            std::uint64_t current = target.load(std::memory_order_relaxed);
+            while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            }
+        }
+    }
+    
+    // Implementarea TaskPoolStats
+    TaskPoolStats::TaskPoolStats()
+        : threadCount(0), submitted(0), executed(0), stolen(0), runByCaller(0),
+          totalTaskNanoseconds(0), maxTaskNanoseconds(0) {
+    }
+    
+    double TaskPoolStats::GetAverageTaskMicroseconds() const {
+        return executed ? totalTaskNanoseconds / 1000.0 / executed : 0.0;
+    }
+    
+    // Implementarea TaskPool
+    TaskPool::TaskPool(size_t threads)
+        : m_queued(0), m_next_queue(0), m_submitted(0), m_stop(false) {
+        _Start(threads);
+    }
+    
+    TaskPool::~TaskPool() {
+        _Stop();
+    }
+    
+    void TaskPool::_Start(size_t threads) {
+        m_stop = false;
+        
+        // Pastram contoarele firelor vechi, ca statisticile sa ramana cumulative
+        for (const auto& worker : m_workers) {
+            m_retired.executed.fetch_add(worker->executed.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            m_retired.stolen.fetch_add(worker->stolen.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            m_retired.nanoseconds.fetch_add(worker->nanoseconds.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            UpdateMax(m_retired.maxNanoseconds, worker->maxNanoseconds.load(std::memory_order_relaxed));
+        }
+        m_workers.clear();
+        for (size_t i = 0; i < threads; ++i) {
+            m_workers.push_back(std::unique_ptr<Worker>(new Worker()));
+        }
+        for (size_t i = 0; i < threads; ++i) {
+            m_threads.emplace_back(&TaskPool::_WorkerLoop, this, i);
+        }
+    }
+    
+    void TaskPool::_Stop() {
+        {
+            std::lock_guard<std::mutex> lock(m_sleep_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+        m_threads.clear();
+    }
+    
+    void TaskPool::_WorkerLoop(size_t index) {
+        t_pool = this;
+        t_worker = static_cast<int>(index);
+        
+        Task task;
+        while (true) {
+            if (_TryPop(t_worker, task)) {
+                _Execute(task, *m_workers[index]);
+                continue;
+            }
+            
+            // Nu exista lucru: firul doarme pana la urmatoarea sarcina; la oprire iese doar cu cozile goale
+            std::unique_lock<std::mutex> lock(m_sleep_mutex);
+            m_wake.wait(lock, [this]() { return m_stop || m_queued.load(std::memory_order_acquire) > 0; });
+            if (m_stop && m_queued.load(std::memory_order_acquire) == 0) {
+                break;
+            }
+        }
+        
+        t_pool = nullptr;
+        t_worker = -1;
+    }
+    
+    int TaskPool::_CurrentWorker() const {
+        return t_pool == this ? t_worker : -1;
+    }
+    
+    bool TaskPool::_TryPop(int self, Task& task) {
+        if (m_queued.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        
+        // Coada proprie, de la capat (sarcina cea mai recenta, cu datele inca in cache)
+        if (self >= 0) {
+            Worker& own = *m_workers[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                m_queued.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+        }
+        
+        // Furt din celelalte cozi, de la inceput (sarcinile cele mai vechi, de obicei cele mai mari)
+        size_t count = m_workers.size();
+        size_t start = self >= 0 ? static_cast<size_t>(self) + 1 : 0;
+        for (size_t i = 0; i < count; ++i) {
+            size_t victim = (start + i) % count;
+            if (static_cast<int>(victim) == self) {
+                continue;
+            }
+            Worker& other = *m_workers[victim];
+            std::lock_guard<std::mutex> lock(other.mutex);
+            if (!other.tasks.empty()) {
+                task = std::move(other.tasks.front());
+                other.tasks.pop_front();
+                m_queued.fetch_sub(1, std::memory_order_acq_rel);
+                Worker& thief = self >= 0 ? *m_workers[self] : m_caller;
+                thief.stolen.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    void TaskPool::_Execute(Task& task, Worker& stats) {
+        auto start = std::chrono::steady_clock::now();
+        task();
+        auto nanoseconds = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        task = nullptr;
+        
+        stats.executed.fetch_add(1, std::memory_order_relaxed);
+        stats.nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+        UpdateMax(stats.maxNanoseconds, nanoseconds);
+    }
+    
+    size_t TaskPool::GetThreadCount() const {
+        return m_workers.size();
+    }
+    
+    void TaskPool::Resize(size_t threads) {
+        if (threads == m_workers.size()) {
+            return;
+        }
+        _Stop();
+        _Start(threads);
+    }
+    
+    void TaskPool::Submit(Task task) {
+        m_submitted.fetch_add(1, std::memory_order_relaxed);
+        if (m_workers.empty()) {
+            _Execute(task, m_caller);
+            return;
+        }
+        
+        // Firele pool-ului pun sarcinile in coada proprie; celelalte le distribuie pe rand
+        int self = _CurrentWorker();
+        size_t queue = self >= 0 ? static_cast<size_t>(self)
+                                 : m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+        {
+            Worker& worker = *m_workers[queue];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.tasks.push_back(std::move(task));
+        }
+        m_queued.fetch_add(1, std::memory_order_acq_rel);
+        
+        // Luam mutex-ul inainte de notificare, ca un fir care tocmai verifica m_queued sa nu piarda trezirea
+        {
+            std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        }
+        m_wake.notify_one();
+    }
+    
+    bool TaskPool::RunPendingTask() {
+        int self = _CurrentWorker();
+        Task task;
+        if (!_TryPop(self, task)) {
+            return false;
+        }
+        _Execute(task, self >= 0 ? *m_workers[self] : m_caller);
+        return true;
+    }
+    
+    TaskPoolStats TaskPool::GetStats() const {
+        TaskPoolStats stats;
+        stats.threadCount = m_workers.size();
+        stats.submitted = m_submitted.load(std::memory_order_relaxed);
+        
+        auto add = [&stats](const Worker& worker) {
+            stats.executed += worker.executed.load(std::memory_order_relaxed);
+            stats.stolen += worker.stolen.load(std::memory_order_relaxed);
+            stats.totalTaskNanoseconds += worker.nanoseconds.load(std::memory_order_relaxed);
+            stats.maxTaskNanoseconds = std::max(stats.maxTaskNanoseconds, worker.maxNanoseconds.load(std::memory_order_relaxed));
+        };
+        for (const auto& worker : m_workers) {
+            add(*worker);
+            stats.executedPerThread.push_back(worker->executed.load(std::memory_order_relaxed));
+        }
+        add(m_caller);
+        add(m_retired);
+        stats.runByCaller = m_caller.executed.load(std::memory_order_relaxed);
+        return stats;
+    }
+    
+    void TaskPool::ResetStats() {
+        m_submitted.store(0, std::memory_order_relaxed);
+        auto reset = [](Worker& worker) {
+            worker.executed.store(0, std::memory_order_relaxed);
+            worker.stolen.store(0, std::memory_order_relaxed);
+            worker.nanoseconds.store(0, std::memory_order_relaxed);
+            worker.maxNanoseconds.store(0, std::memory_order_relaxed);
+        };
+        for (auto& worker : m_workers) {
+            reset(*worker);
+        }
+        reset(m_caller);
+        reset(m_retired);
+    }
+    
+    TaskPool& TaskPool::GetDefault() {
+        static TaskPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+        return pool;
+    }
+    
+    // Implementarea TaskGroup
+    TaskGroup::TaskGroup(TaskPool& pool) : m_pool(pool), m_pending(0) {
+    }
+    
+    TaskGroup::~TaskGroup() {
+        _WaitPending();
+    }
+    
+    void TaskGroup::_WaitPending() {
+        // Cat timp grupul nu s-a terminat, firul curent ajuta la executia sarcinilor din pool
+        while (m_pending.load(std::memory_order_acquire) > 0) {
+            if (!m_pool.RunPendingTask()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+    
+    void TaskGroup::Run(TaskPool::Task task) {
+        m_pending.fetch_add(1, std::memory_order_relaxed);
+        m_pool.Submit([this, task = std::move(task)]() {
+            // Exceptia este pastrata pentru Wait; sarcina se numara ca terminata in orice caz
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_error_mutex);
+                if (!m_error) {
+                    m_error = std::current_exception();
+                }
+            }
+            m_pending.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+    
+    void TaskGroup::Wait() {
+        _WaitPending();
+        
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(m_error_mutex);
+            std::swap(error, m_error);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
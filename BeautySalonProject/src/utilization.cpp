@@ -0,0 +1,214 @@
+#include "utilization.h"
+#include <algorithm>
+
+namespace Beauty_Salon {
+    namespace {
+        constexpr int RING_MASK = UtilizationTracker::WINDOW_DAYS - 1;
+        static_assert((UtilizationTracker::WINDOW_DAYS & RING_MASK) == 0, "WINDOW_DAYS trebuie sa fie putere a lui 2");
+        
+        constexpr int PREFIX_STRIDE = UtilizationTracker::WINDOW_DAYS + 1;
+        constexpr int HOUR_STRIDE = UtilizationTracker::WINDOW_DAYS * UtilizationTracker::HOURS_PER_DAY;
+    }
+    
+    UtilizationTracker::UtilizationTracker() 
+        : m_slot_count(0), m_window_start(0), m_daily_capacity(11 * 60), m_ignored_minutes(0) {
+    }
+    
+    // Metode private
+    int UtilizationTracker::_SlotOf(int employeeId) const {
+        if (employeeId < 0 || static_cast<size_t>(employeeId) >= m_slot_of_id.size()) {
+            return -1;
+        }
+        return m_slot_of_id[employeeId];
+    }
+    
+    int UtilizationTracker::_EnsureSlot(int employeeId) {
+        int slot = _SlotOf(employeeId);
+        if (slot >= 0 || employeeId < 0) {
+            return slot;
+        }
+        
+        if (static_cast<size_t>(employeeId) >= m_slot_of_id.size()) {
+            m_slot_of_id.resize(employeeId + 1, -1);
+        }
+        slot = m_slot_count++;
+        m_slot_of_id[employeeId] = slot;
+        m_day_minutes.resize(static_cast<size_t>(m_slot_count) * WINDOW_DAYS, 0);
+        m_prefix.resize(static_cast<size_t>(m_slot_count) * PREFIX_STRIDE, 0);
+        m_hour_minutes.resize(static_cast<size_t>(m_slot_count) * HOUR_STRIDE, 0);
+        m_bookings.push_back(0);
+        return slot;
+    }
+    
+    void UtilizationTracker::_AddDayMinutes(int slot, int day, int hour, int minutes) {
+        int offset = day - m_window_start;
+        if (offset < 0 || offset >= WINDOW_DAYS) {
+            if (offset < 0 && minutes > 0) {
+                m_ignored_minutes += minutes;
+            }
+            return;
+        }
+        
+        int ring = day & RING_MASK;
+        m_day_minutes[static_cast<size_t>(slot) * WINDOW_DAYS + ring] += minutes;
+        m_hour_minutes[static_cast<size_t>(slot) * HOUR_STRIDE + ring * HOURS_PER_DAY + hour] += minutes;
+        
+        // Sumele prefix de dupa aceasta zi (cel mult WINDOW_DAYS adunari, doar la rezervari)
+        int* prefix = &m_prefix[static_cast<size_t>(slot) * PREFIX_STRIDE];
+        for (int i = offset + 1; i <= WINDOW_DAYS; ++i) {
+            prefix[i] += minutes;
+        }
+    }
+    
+    void UtilizationTracker::_AdvanceWindow(int windowStart) {
+        // Zilele care ies din fereastra (toate, daca fereastra sare peste WINDOW_DAYS zile)
+        int leaving = std::min(windowStart - m_window_start, static_cast<int>(WINDOW_DAYS));
+        for (int slot = 0; slot < m_slot_count; ++slot) {
+            for (int i = 0; i < leaving; ++i) {
+                int ring = (m_window_start + i) & RING_MASK;
+                m_day_minutes[static_cast<size_t>(slot) * WINDOW_DAYS + ring] = 0;
+                int* hours = &m_hour_minutes[static_cast<size_t>(slot) * HOUR_STRIDE + ring * HOURS_PER_DAY];
+                std::fill(hours, hours + HOURS_PER_DAY, 0);
+            }
+        }
+        m_window_start = windowStart;
+        
+        // Sumele prefix urmeaza ordinea zilelor din fereastra, deci se refac pentru noul inceput
+        for (int slot = 0; slot < m_slot_count; ++slot) {
+            const int* days = &m_day_minutes[static_cast<size_t>(slot) * WINDOW_DAYS];
+            int* prefix = &m_prefix[static_cast<size_t>(slot) * PREFIX_STRIDE];
+            for (int i = 0; i < WINDOW_DAYS; ++i) {
+                prefix[i + 1] = prefix[i] + days[(m_window_start + i) & RING_MASK];
+            }
+        }
+    }
+    
+    void UtilizationTracker::_Apply(int slot, const TimeSlot& timeSlot, int sign) {
+        long long start = timeSlot.GetAbsoluteStart();
+        long long end = timeSlot.GetAbsoluteEnd();
+        
+        // O rezervare noua dupa fereastra muta fereastra astfel incat ultima ei zi sa fie ultima zi urmarita
+        if (sign > 0 && end > start) {
+            long long lastDay = (end - 1) / TimeSlot::MINUTES_PER_DAY;
+            if (lastDay >= static_cast<long long>(m_window_start) + WINDOW_DAYS) {
+                _AdvanceWindow(static_cast<int>(lastDay - WINDOW_DAYS + 1));
+            }
+        }
+        
+        // Minutele dinaintea zilei 0 sunt mereu inaintea ferestrei (care incepe la o zi >= 0): le numaram
+        // si nu le impartim pe zile, deci impartirile de mai jos lucreaza doar cu valori pozitive
+        if (start < 0) {
+            long long clipped = std::min<long long>(end, 0);
+            if (sign > 0) {
+                m_ignored_minutes += clipped - start;
+            }
+            start = clipped;
+        }
+        
+        // Impartim intervalul pe ore (si pe zile, daca trece de miezul noptii)
+        while (start < end) {
+            long long hourEnd = std::min(end, (start / 60 + 1) * 60);
+            int day = static_cast<int>(start / TimeSlot::MINUTES_PER_DAY);
+            int hour = static_cast<int>((start % TimeSlot::MINUTES_PER_DAY) / 60);
+            _AddDayMinutes(slot, day, hour, sign * static_cast<int>(hourEnd - start));
+            start = hourEnd;
+        }
+        m_bookings[slot] += sign;
+    }
+    
+    // Configurare
+    int UtilizationTracker::GetDailyCapacity() const {
+        return m_daily_capacity;
+    }
+    
+    void UtilizationTracker::SetDailyCapacity(int minutes) {
+        if (minutes > 0) {
+            m_daily_capacity = minutes;
+        }
+    }
+    
+    int UtilizationTracker::GetWindowStart() const {
+        return m_window_start;
+    }
+    
+    void UtilizationTracker::ResetWindow(int windowStart) {
+        m_window_start = std::max(windowStart, 0);
+        Clear();
+    }
+    
+    // Rezervari
+    void UtilizationTracker::AddBooking(const Employee* employee, const TimeSlot& timeSlot) {
+        if (!employee) {
+            return;
+        }
+        int slot = _EnsureSlot(employee->GetID());
+        if (slot >= 0) {
+            _Apply(slot, timeSlot, 1);
+        }
+    }
+    
+    void UtilizationTracker::RemoveBooking(const Employee* employee, const TimeSlot& timeSlot) {
+        if (!employee) {
+            return;
+        }
+        int slot = _SlotOf(employee->GetID());
+        if (slot >= 0 && m_bookings[slot] > 0) {
+            _Apply(slot, timeSlot, -1);
+        }
+    }
+    
+    void UtilizationTracker::Clear() {
+        std::fill(m_day_minutes.begin(), m_day_minutes.end(), 0);
+        std::fill(m_prefix.begin(), m_prefix.end(), 0);
+        std::fill(m_hour_minutes.begin(), m_hour_minutes.end(), 0);
+        std::fill(m_bookings.begin(), m_bookings.end(), 0);
+        m_ignored_minutes = 0;
+    }
+    
+    long long UtilizationTracker::GetIgnoredMinutes() const {
+        return m_ignored_minutes;
+    }
+    
+    // Interogari
+    int UtilizationTracker::GetActiveBookings(int employeeId) const {
+        int slot = _SlotOf(employeeId);
+        return slot >= 0 ? m_bookings[slot] : 0;
+    }
+    
+    int UtilizationTracker::GetBookedMinutes(int employeeId, int firstDay, int dayCount) const {
+        int slot = _SlotOf(employeeId);
+        if (slot < 0 || dayCount <= 0) {
+            return 0;
+        }
+        
+        // Limitam intervalul la fereastra urmarita
+        int lo = std::max(firstDay - m_window_start, 0);
+        int hi = std::min(firstDay + dayCount - m_window_start, static_cast<int>(WINDOW_DAYS));
+        if (lo >= hi) {
+            return 0;
+        }
+        const int* prefix = &m_prefix[static_cast<size_t>(slot) * PREFIX_STRIDE];
+        return prefix[hi] - prefix[lo];
+    }
+    
+    int UtilizationTracker::GetBookedMinutesInHour(int employeeId, int day, int hour) const {
+        int slot = _SlotOf(employeeId);
+        int offset = day - m_window_start;
+        if (slot < 0 || offset < 0 || offset >= WINDOW_DAYS || hour < 0 || hour >= HOURS_PER_DAY) {
+            return 0;
+        }
+        return m_hour_minutes[static_cast<size_t>(slot) * HOUR_STRIDE + (day & RING_MASK) * HOURS_PER_DAY + hour];
+    }
+    
+    double UtilizationTracker::GetBusyRatio(int employeeId, int firstDay, int dayCount) const {
+        if (dayCount <= 0) {
+            return 0.0;
+        }
+        return static_cast<double>(GetBookedMinutes(employeeId, firstDay, dayCount)) / 
+               (static_cast<double>(m_daily_capacity) * dayCount);
+    }
+    
+    int UtilizationTracker::GetSlotCount() const {
+        return m_slot_count;
+    }
+}
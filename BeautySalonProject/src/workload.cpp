@@ -0,0 +1,392 @@
+#include "workload.h"
+#include "service_definitions.h"
+#include "format.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace Beauty_Salon {
+    namespace {
+        constexpr std::size_t MINUTE_TABLE_SIZE = 1024;
+        constexpr std::size_t SERVICE_TABLE_SIZE = 256;
+        constexpr int MINUTE_STEP = 15;
+        constexpr std::size_t FLUSH_BYTES = 64 * 1024;
+        
+        // Samanta pentru datele salonului, separata de cea a traficului
+        constexpr std::uint64_t POPULATE_SEED_MIX = 0x5A10A5A10A5A10A5ULL;
+        
+        // Amestecul de servicii (ponderi relative pe tip)
+        double ServiceWeight(ServiceType type) {
+            switch (type) {
+                case ServiceType::HAIR_CUT: return 34.0;
+                case ServiceType::HAIR_COLOR: return 12.0;
+                case ServiceType::MANICURE: return 22.0;
+                case ServiceType::PEDICURE: return 12.0;
+                case ServiceType::MASSAGE: return 12.0;
+                case ServiceType::FACIAL: return 8.0;
+                default: return 1.0;
+            }
+        }
+        
+        // Profilul zilnic al orelor cerute: varf in jurul orei 11, varf mai mare in jurul orei 17:30, putin la pranz
+        double DiurnalWeight(int minute) {
+            double morning = (minute - 11 * 60) / 75.0;
+            double evening = (minute - (17 * 60 + 30)) / 60.0;
+            return 0.25 + std::exp(-0.5 * morning * morning) + 1.3 * std::exp(-0.5 * evening * evening);
+        }
+        
+        // Cererea relativa dupa ziua saptamanii (ziua 0 = luni); duminica salonul e inchis
+        double WeekdayFactor(int day) {
+            static const double factors[7] = {0.8, 0.9, 1.0, 1.0, 1.2, 1.5, 0.0};
+            int weekday = day % 7;
+            return factors[weekday < 0 ? weekday + 7 : weekday];
+        }
+        
+        // Transforma ponderile in tabelul de cuantile (intrarea i = valoarea pentru probabilitatea (i + 0.5) / size)
+        template <typename T>
+        void BuildQuantileTable(const std::vector<double>& weights, const std::vector<T>& values, std::vector<T>& table,
+                                std::size_t size) {
+            double total = 0.0;
+            for (double weight : weights) {
+                total += weight;
+            }
+            table.resize(size);
+            double cumulative = 0.0;
+            std::size_t index = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                double target = (static_cast<double>(i) + 0.5) / static_cast<double>(size) * total;
+                while (index + 1 < weights.size() && cumulative + weights[index] < target) {
+                    cumulative += weights[index];
+                    ++index;
+                }
+                table[i] = values[index];
+            }
+        }
+        
+        template <std::size_t... Indexes>
+        void AddMenuServices(ServiceCatalog& catalog, std::index_sequence<Indexes...>) {
+            (catalog.AddService(std::unique_ptr<Service>(new MenuService<Indexes>())), ...);
+        }
+    }
+    
+    // Implementarea WorkloadConfig
+    WorkloadConfig::WorkloadConfig()
+        : seed(1), clientCount(5000), stylistCount(8), technicianCount(6), productCount(200), firstDay(0),
+          dayCount(90), bookingsPerDay(80), maxLeadDays(13), cancelRate(0.08), noShowRate(0.04),
+          requestedEmployeeRate(0.3), openHour(9), closeHour(20) {
+    }
+    
+    // Implementarea WorkloadStats
+    WorkloadStats::WorkloadStats()
+        : events(0), bookings(0), cancellations(0), completions(0), noShows(0), rejectedBookings(0) {
+    }
+    
+    // Implementarea WorkloadGenerator
+    WorkloadGenerator::WorkloadGenerator(const WorkloadConfig& config)
+        : m_config(config), m_rng(config.seed), m_next_event(0), m_day(0), m_bookings(0),
+          m_wrote_header(false) {
+        m_config.maxLeadDays = std::max(0, std::min(m_config.maxLeadDays, PENDING_DAYS - 2));
+        m_config.clientCount = std::max(1, m_config.clientCount);
+        // Zilele negative ar da un indice negativ in m_pending (day % PENDING_DAYS)
+        m_config.firstDay = std::max(0, m_config.firstDay);
+        m_day = m_config.firstDay;
+        _BuildTables();
+    }
+    
+    const WorkloadConfig& WorkloadGenerator::GetConfig() const {
+        return m_config;
+    }
+    
+    const WorkloadStats& WorkloadGenerator::GetStats() const {
+        return m_stats;
+    }
+    
+    void WorkloadGenerator::Reset() {
+        m_rng = SplitMix64(m_config.seed);
+        for (auto& pending : m_pending) {
+            pending.clear();
+        }
+        m_day_events.clear();
+        m_next_event = 0;
+        m_day = m_config.firstDay;
+        m_bookings = 0;
+        m_stats = WorkloadStats();
+        m_appointment_ids.clear();
+        m_wrote_header = false;
+    }
+    
+    void WorkloadGenerator::_BuildTables() {
+        std::vector<double> weights;
+        std::vector<std::uint16_t> minutes;
+        for (int minute = m_config.openHour * 60; minute < m_config.closeHour * 60; minute += MINUTE_STEP) {
+            weights.push_back(DiurnalWeight(minute));
+            minutes.push_back(static_cast<std::uint16_t>(minute));
+        }
+        if (minutes.empty()) {
+            weights.push_back(1.0);
+            minutes.push_back(static_cast<std::uint16_t>(m_config.openHour * 60));
+        }
+        BuildQuantileTable(weights, minutes, m_minute_table, MINUTE_TABLE_SIZE);
+        
+        weights.clear();
+        std::vector<std::uint8_t> services;
+        for (std::size_t i = 0; i < SALON_MENU_SIZE; ++i) {
+            weights.push_back(ServiceWeight(SALON_MENU[i].type));
+            services.push_back(static_cast<std::uint8_t>(i));
+        }
+        BuildQuantileTable(weights, services, m_service_table, SERVICE_TABLE_SIZE);
+    }
+    
+    void WorkloadGenerator::PopulateSalon(ServiceCatalog& catalog, std::vector<std::unique_ptr<Employee>>& employees,
+                                          std::vector<Client>& clients, Inventory& inventory) const {
+        SplitMix64 rng(m_config.seed ^ POPULATE_SEED_MIX);
+        
+        AddMenuServices(catalog, std::make_index_sequence<SALON_MENU_SIZE>());
+        
+        // Stilistii cu index par fac si vopsit; tehnicienii au certificari pentru unghii sau spa
+        for (int i = 0; i < m_config.stylistCount; ++i) {
+            double rate = 18.0 + rng.NextBelow(15);
+            employees.push_back(std::unique_ptr<Employee>(
+                new Stylist("Stilist " + std::to_string(i + 1), rate, i % 2 == 0, 1 + static_cast<int>(rng.NextBelow(15)))));
+        }
+        for (int i = 0; i < m_config.technicianCount; ++i) {
+            double rate = 17.0 + rng.NextBelow(10);
+            Technician* technician = new Technician("Tehnician " + std::to_string(i + 1), rate, rng.NextBelow(4) != 0);
+            technician->AddCertification(i % 2 == 0 ? "Nail Art Specialist" : "Spa Specialist");
+            employees.push_back(std::unique_ptr<Employee>(technician));
+        }
+        catalog.BuildQualifications(employees);
+        
+        clients.reserve(clients.size() + static_cast<std::size_t>(m_config.clientCount));
+        for (int i = 0; i < m_config.clientCount; ++i) {
+            std::string phone = "07" + std::to_string(20000000 + rng.NextBelow(79999999));
+            std::string name = "Client " + std::to_string(i + 1);
+            if (rng.NextBelow(3) != 0) {
+                clients.push_back(Client(name, phone, "client" + std::to_string(i + 1) + "@email.com"));
+            } else {
+                clients.push_back(Client(name, phone));
+            }
+            // Clientii cu index mic revin des (vezi alegerea clientului in _GenerateDay)
+            int visits = static_cast<int>(rng.NextBelow(static_cast<std::uint32_t>(12 * (m_config.clientCount - i) / m_config.clientCount + 1)));
+            for (int v = 0; v < visits; ++v) {
+                clients.back().AddVisit();
+            }
+        }
+        
+        static const ProductCategory categories[] = {
+            ProductCategory::HAIR_CARE, ProductCategory::SKIN_CARE, ProductCategory::NAIL_CARE, ProductCategory::MAKEUP
+        };
+        for (int i = 0; i < m_config.productCount; ++i) {
+            std::string name = "Produs " + std::to_string(i + 1);
+            std::string brand = "Brand " + std::to_string(1 + rng.NextBelow(20));
+            double price = 5.0 + rng.NextBelow(9500) / 100.0;
+            ProductCategory category = categories[rng.NextBelow(4)];
+            Product* product = i % 3 == 0
+                ? inventory.AddProduct(std::unique_ptr<Product>(new ProfessionalProduct(name, brand, price, category, "Furnizor " + std::to_string(1 + rng.NextBelow(5)))))
+                : inventory.AddProduct(std::unique_ptr<Product>(new RetailProduct(name, brand, price, category, 0.3 + rng.NextBelow(30) / 100.0)));
+            if (product) {
+                inventory.Restock(product->GetID(), 5 + static_cast<int>(rng.NextBelow(60)));
+            }
+        }
+    }
+    
+    int WorkloadGenerator::_PickEmployee(int service) {
+        if (m_rng.NextDouble() >= m_config.requestedEmployeeRate) {
+            return -1;
+        }
+        switch (SALON_MENU[service].type) {
+            case ServiceType::HAIR_CUT:
+                return m_config.stylistCount > 0 ? static_cast<int>(m_rng.NextBelow(m_config.stylistCount)) : -1;
+            case ServiceType::HAIR_COLOR:
+                return m_config.stylistCount > 0 ? 2 * static_cast<int>(m_rng.NextBelow((m_config.stylistCount + 1) / 2)) : -1;
+            case ServiceType::MANICURE:
+            case ServiceType::PEDICURE:
+                return m_config.technicianCount > 0
+                    ? m_config.stylistCount + static_cast<int>(m_rng.NextBelow(m_config.technicianCount)) : -1;
+            default:
+                return -1;
+        }
+    }
+    
+    void WorkloadGenerator::_GenerateDay() {
+        const int today = m_day++;
+        const int lastDay = m_config.firstDay + m_config.dayCount - 1;
+        const int closeMinute = m_config.closeHour * 60;
+        m_day_events.clear();
+        m_next_event = 0;
+        
+        // Numarul de programari facute azi variaza cu +/-10%
+        double volume = m_config.bookingsPerDay * (0.9 + 0.2 * m_rng.NextDouble());
+        int count = static_cast<int>(volume + 0.5);
+        for (int i = 0; i < count; ++i) {
+            // Ziua programarii: de obicei aproape de azi, acceptata dupa cererea zilei respective (nu duminica)
+            int maxLead = std::min(m_config.maxLeadDays, lastDay - today);
+            int day = today;
+            bool found = false;
+            for (int attempt = 0; attempt < 8 && !found; ++attempt) {
+                int lead = static_cast<int>(m_rng.NextBelow(maxLead + 1) * m_rng.NextDouble());
+                day = today + lead;
+                found = m_rng.NextDouble() * 1.5 < WeekdayFactor(day);
+            }
+            if (!found) {
+                continue;
+            }
+            
+            WorkloadEvent event;
+            event.type = WorkloadEventType::BOOK;
+            event.booking = m_bookings++;
+            event.day = day;
+            event.service = m_service_table[m_rng.Next() >> 56];
+            event.minute = m_minute_table[m_rng.Next() >> 54];
+            int duration = SALON_MENU[event.service].duration;
+            if (event.minute + duration > closeMinute) {
+                event.minute = std::max(m_config.openHour * 60, (closeMinute - duration) / MINUTE_STEP * MINUTE_STEP);
+            }
+            // Doua extrageri si minimul: clientii cu index mic (fideli) apar mai des
+            std::uint32_t clientCount = static_cast<std::uint32_t>(m_config.clientCount);
+            event.client = static_cast<int>(std::min(m_rng.NextBelow(clientCount), m_rng.NextBelow(clientCount)));
+            event.employee = _PickEmployee(event.service);
+            m_day_events.push_back(event);
+            m_stats.bookings++;
+            
+            // Soarta programarii: anulata intre azi si ziua ei, altfel neprezentare sau finalizare in ziua ei
+            WorkloadEvent outcome = event;
+            outcome.employee = -1;
+            double fate = m_rng.NextDouble();
+            int outcomeDay = day;
+            if (fate < m_config.cancelRate) {
+                outcome.type = WorkloadEventType::CANCEL;
+                outcomeDay = today + static_cast<int>(m_rng.NextBelow(day - today + 1));
+            } else if (fate < m_config.cancelRate + m_config.noShowRate) {
+                outcome.type = WorkloadEventType::NO_SHOW;
+            } else {
+                outcome.type = WorkloadEventType::COMPLETE;
+            }
+            m_pending[outcomeDay % PENDING_DAYS].push_back(outcome);
+        }
+        
+        // Evenimentele zilei care privesc programari facute mai devreme (sau azi)
+        std::vector<WorkloadEvent>& pending = m_pending[today % PENDING_DAYS];
+        for (const auto& event : pending) {
+            switch (event.type) {
+                case WorkloadEventType::CANCEL: m_stats.cancellations++; break;
+                case WorkloadEventType::NO_SHOW: m_stats.noShows++; break;
+                default: m_stats.completions++; break;
+            }
+        }
+        m_day_events.insert(m_day_events.end(), pending.begin(), pending.end());
+        pending.clear();
+    }
+    
+    bool WorkloadGenerator::Next(WorkloadEvent& event) {
+        while (m_next_event == m_day_events.size()) {
+            if (m_day >= m_config.firstDay + m_config.dayCount) {
+                return false;
+            }
+            _GenerateDay();
+        }
+        event = m_day_events[m_next_event++];
+        m_stats.events++;
+        return true;
+    }
+    
+    std::size_t WorkloadGenerator::StreamInto(Schedule& schedule, const ServiceCatalog& catalog,
+                                              const std::vector<std::unique_ptr<Employee>>& employees,
+                                              const std::vector<Client>& clients, std::size_t maxEvents) {
+        const auto& services = catalog.GetServices();
+        std::size_t consumed = 0;
+        WorkloadEvent event;
+        while (consumed < maxEvents && Next(event)) {
+            ++consumed;
+            if (event.type == WorkloadEventType::BOOK) {
+                int id = 0;
+                if (static_cast<std::size_t>(event.service) < services.size() &&
+                    static_cast<std::size_t>(event.client) < clients.size()) {
+                    Service* service = services[event.service].get();
+                    Employee* employee = event.employee >= 0 && static_cast<std::size_t>(event.employee) < employees.size()
+                                         ? employees[event.employee].get() : nullptr;
+                    TimeSlot slot = TimeSlot::FromMinutes(event.day, event.minute, service->GetDuration());
+                    bool added = employee ? schedule.AddAppointment(clients[event.client], employee, service, slot)
+                                          : schedule.AddAppointment(clients[event.client], service, slot);
+                    if (added) {
+                        id = schedule.GetAppointments().back().GetID();
+                    }
+                }
+                if (id == 0) {
+                    m_stats.rejectedBookings++;
+                }
+                m_appointment_ids.push_back(id);
+                continue;
+            }
+            
+            // Programarile respinse nu mai pot fi anulate sau finalizate
+            int id = event.booking < m_appointment_ids.size() ? m_appointment_ids[event.booking] : 0;
+            if (id == 0) {
+                continue;
+            }
+            switch (event.type) {
+                case WorkloadEventType::CANCEL: schedule.CancelAppointment(id); break;
+                case WorkloadEventType::COMPLETE: schedule.CompleteAppointment(id); break;
+                case WorkloadEventType::NO_SHOW: schedule.MarkNoShow(id); break;
+                default: break;
+            }
+        }
+        return consumed;
+    }
+    
+    std::size_t WorkloadGenerator::WriteCommands(std::ostream& out, const std::vector<std::unique_ptr<Employee>>& employees,
+                                                 std::size_t maxEvents) {
+        TextBuffer buffer;
+        if (!m_wrote_header) {
+            buffer.Append("# workload seed=").AppendInteger(static_cast<long long>(m_config.seed))
+                  .Append(" days=").AppendInteger(m_config.dayCount)
+                  .Append(" bookings_per_day=").AppendInteger(m_config.bookingsPerDay).Append('\n');
+            m_wrote_header = true;
+        }
+        
+        std::size_t consumed = 0;
+        WorkloadEvent event;
+        while (consumed < maxEvents && Next(event)) {
+            ++consumed;
+            switch (event.type) {
+                case WorkloadEventType::BOOK: {
+                    const char* service = SALON_MENU[event.service].name;
+                    char time[5] = {
+                        static_cast<char>('0' + event.minute / 600), static_cast<char>('0' + event.minute / 60 % 10), ':',
+                        static_cast<char>('0' + event.minute % 60 / 10), static_cast<char>('0' + event.minute % 10)
+                    };
+                    buffer.Append("book ").AppendInteger(event.client + 1);
+                    if (std::strchr(service, ' ')) {
+                        buffer.Append(" \"").Append(service).Append('"');
+                    } else {
+                        buffer.Append(' ').Append(service);
+                    }
+                    buffer.Append(' ').AppendInteger(event.day).Append(' ').Append(time, sizeof(time));
+                    if (event.employee >= 0 && static_cast<std::size_t>(event.employee) < employees.size()) {
+                        buffer.Append(' ').AppendInteger(employees[event.employee]->GetID());
+                    }
+                    buffer.Append('\n');
+                    break;
+                }
+                case WorkloadEventType::CANCEL:
+                    buffer.Append("cancel @").AppendInteger(static_cast<long long>(event.booking) + 1).Append('\n');
+                    break;
+                case WorkloadEventType::COMPLETE:
+                    buffer.Append("complete @").AppendInteger(static_cast<long long>(event.booking) + 1).Append('\n');
+                    break;
+                case WorkloadEventType::NO_SHOW:
+                    buffer.Append("noshow @").AppendInteger(static_cast<long long>(event.booking) + 1).Append('\n');
+                    break;
+            }
+            
+            if (buffer.Size() >= FLUSH_BYTES) {
+                buffer.WriteTo(out);
+                buffer.Clear();
+            }
+        }
+        buffer.WriteTo(out);
+        return consumed;
+    }
+}